@@ -0,0 +1,87 @@
+#!/bin/bash
+# Benchmark de las cuatro variantes (clases/estructuras x referencia/valor)
+# ------------------------------------------------------------------------
+# POR QUÉ: Las tablas del README se tomaron a mano desde el menú, una corrida por
+#          análisis; no se pueden repetir ni muestran la variación entre corridas.
+# CÓMO: Compila cada variante con su Makefile y la ejecuta con --benchmark (misma
+#       semilla, mismos tamaños y análisis); cada variante hace calentamiento y
+#       repeticiones, y el programa calcula mediana, p95 y desviación estándar.
+# PARA QUÉ: Guardar resultados comparables (CSV o JSON) para seguir regresiones y
+#           curvas de escalamiento entre 10^4 y 10^7 personas.
+#
+# Uso: ./benchmark.sh [-n "10000 100000 ..."] [-a clave,clave] [-w calentamiento]
+#                     [-r repeticiones] [-s semilla] [-f csv|json] [-o archivo] [-t hilos]
+#
+# 10^7 personas necesita varios GB de memoria por variante; use -n para limitar los tamaños.
+
+set -e
+cd "$(dirname "$0")"
+
+TAMANOS="10000 100000 1000000 10000000"
+ANALISIS=""
+CALENTAMIENTO=1
+REPETICIONES=5
+SEMILLA=1
+FORMATO=csv
+SALIDA=""
+HILOS=""
+
+while getopts "n:a:w:r:s:f:o:t:h" opcion; do
+    case $opcion in
+        n) TAMANOS="$OPTARG" ;;
+        a) ANALISIS="$OPTARG" ;;
+        w) CALENTAMIENTO="$OPTARG" ;;
+        r) REPETICIONES="$OPTARG" ;;
+        s) SEMILLA="$OPTARG" ;;
+        f) FORMATO="$OPTARG" ;;
+        o) SALIDA="$OPTARG" ;;
+        t) HILOS="$OPTARG" ;;
+        *) sed -n '12,13p' "$0" >&2; exit 1 ;;
+    esac
+done
+if [ "$FORMATO" != csv ] && [ "$FORMATO" != json ]; then
+    echo "Formato inválido: $FORMATO (csv o json)" >&2
+    exit 1
+fi
+
+# Directorio y etiqueta de cada variante
+VARIANTES="referencia/clases:clases_referencia referencia/estructuras:estructuras_referencia
+valor/clases_valores:clases_valor valor/estructuras_valores:estructuras_valor"
+
+ARGUMENTOS=(--benchmark --personas "$(echo $TAMANOS | tr ' ' ',')" --semilla "$SEMILLA"
+            --calentamiento "$CALENTAMIENTO" --repeticiones "$REPETICIONES" --formato "$FORMATO")
+[ -n "$ANALISIS" ] && ARGUMENTOS+=(--analisis "$ANALISIS")
+[ -n "$HILOS" ] && ARGUMENTOS+=(--hilos "$HILOS")
+
+TEMPORAL=$(mktemp -d)
+trap 'rm -rf "$TEMPORAL"' EXIT
+
+for entrada in $VARIANTES; do
+    directorio=${entrada%%:*}
+    variante=${entrada##*:}
+    echo "=== $variante ===" >&2
+    make -s -C "$directorio" >&2
+    (cd "$directorio" && ./programa "${ARGUMENTOS[@]}" --variante "$variante") > "$TEMPORAL/$variante.$FORMATO"
+done
+
+# CSV: una cabecera y las filas de todas las variantes; JSON: un arreglo de filas
+{
+    if [ "$FORMATO" = csv ]; then
+        primero=1
+        for entrada in $VARIANTES; do
+            archivo="$TEMPORAL/${entrada##*:}.csv"
+            if [ $primero = 1 ]; then cat "$archivo"; primero=0; else tail -n +2 "$archivo"; fi
+        done
+    else
+        echo "["
+        separador=""
+        for entrada in $VARIANTES; do
+            filas=$(sed '1d;$d' "$TEMPORAL/${entrada##*:}.json")
+            if [ -n "$filas" ]; then
+                printf '%s%s' "$separador" "$filas"
+                separador=$',\n'
+            fi
+        done
+        printf '\n]\n'
+    fi
+} > "${SALIDA:-/dev/stdout}"
@@ -0,0 +1,118 @@
+#include "agregados.h"
+#include <cmath>
+
+// Ganadores en los que participa una fila (ver GANADOR_* en persona_store.h)
+static std::array<size_t, 5> ganadoresDeFila(const PersonaStore& store, size_t fila) {
+    CiudadId c = store.ciudad[fila];
+    return {GANADOR_LONGEVA, ganadorLongevaCiudad(c), GANADOR_PATRIMONIO,
+            ganadorPatrimonioCiudad(c), ganadorPatrimonioGrupo(indiceGrupo(store.grupoDIAN[fila]))};
+}
+
+// Valor que compara el ganador k: año de nacimiento (longevidad) o patrimonio
+static double valorGanador(const PersonaStore& store, size_t k, size_t fila) {
+    return (k < GANADOR_PATRIMONIO) ? store.anioNacimiento[fila] : store.patrimonio[fila];
+}
+
+void AgregadosPersonas::construir(const PersonaStore& store) {
+    analisis = analisisCompleto(store);
+    sumaRecorrido = analisis.patrimonio.suma;
+    cambios.fill(0);
+    compensacion.fill(0);
+    pendiente.fill(false);
+    recorridos = 0;
+}
+
+/**
+ * Implementación de cambiarPatrimonio.
+ *
+ * CÓMO: Suma compensada de Neumaier: guarda aparte lo que el redondeo de cada suma
+ *       pierde (del sumando menor) y lo agrega al consultar.
+ */
+void AgregadosPersonas::cambiarPatrimonio(CiudadId c, double valor) {
+    double suma = cambios[c] + valor;
+    compensacion[c] += (std::fabs(cambios[c]) >= std::fabs(valor)) ? (cambios[c] - suma) + valor
+                                                                    : (valor - suma) + cambios[c];
+    cambios[c] = suma;
+}
+
+/**
+ * Implementación de proponer.
+ *
+ * CÓMO: Gana el menor año o el mayor patrimonio; en empate, la fila menor, que es la
+ *       que elegiría un recorrido en orden.
+ */
+void AgregadosPersonas::proponer(size_t k, size_t fila, double valor) {
+    if (pendiente[k]) return;  // Se recalculará completo
+    MejorFila& actual = analisis.ganadores[k];
+    bool mejor = (k < GANADOR_PATRIMONIO) ? valor < actual.valor : valor > actual.valor;
+    if (actual.fila == SIN_FILA || mejor || (valor == actual.valor && fila < actual.fila)) {
+        actual.fila = fila;
+        actual.valor = valor;
+    }
+}
+
+void AgregadosPersonas::sumarFila(const PersonaStore& store, size_t fila) {
+    CiudadId c = store.ciudad[fila];
+    int g = indiceGrupo(store.grupoDIAN[fila]);
+    analisis.declarantes.total[g]++;
+    analisis.declarantes.declarantes[g] += store.declaranteRenta[fila];
+    cambiarPatrimonio(c, store.patrimonio[fila]);
+    analisis.patrimonio.conteo[c]++;
+    analisis.mayores60.total[g]++;
+    analisis.mayores60.mayores60[g] += (store.anioNacimiento[fila] < ANIO_ACTUAL - 60);
+
+    for (size_t k : ganadoresDeFila(store, fila)) proponer(k, fila, valorGanador(store, k, fila));
+}
+
+void AgregadosPersonas::restarFila(const PersonaStore& store, size_t fila) {
+    CiudadId c = store.ciudad[fila];
+    int g = indiceGrupo(store.grupoDIAN[fila]);
+    analisis.declarantes.total[g]--;
+    analisis.declarantes.declarantes[g] -= store.declaranteRenta[fila];
+    cambiarPatrimonio(c, -store.patrimonio[fila]);
+    analisis.patrimonio.conteo[c]--;
+    analisis.mayores60.total[g]--;
+    analisis.mayores60.mayores60[g] -= (store.anioNacimiento[fila] < ANIO_ACTUAL - 60);
+
+    for (size_t k : ganadoresDeFila(store, fila)) {
+        if (analisis.ganadores[k].fila == fila) pendiente[k] = true;
+    }
+}
+
+/**
+ * Implementación de moverFila.
+ *
+ * CÓMO: Si la fila era ganadora solo cambia su número (adelantarse no la hace perder un
+ *       empate); si no, al adelantarse puede ganar un empate y se propone de nuevo.
+ */
+void AgregadosPersonas::moverFila(const PersonaStore& store, size_t desde, size_t hasta) {
+    for (size_t k : ganadoresDeFila(store, hasta)) {
+        if (analisis.ganadores[k].fila == desde) analisis.ganadores[k].fila = hasta;
+        else proponer(k, hasta, valorGanador(store, k, hasta));
+    }
+}
+
+const AnalisisCompleto& AgregadosPersonas::consultar(const PersonaStore& store) {
+    if (ganadoresPendientes() > 0) {
+        AnalisisCompleto recorrido = analisisCompleto(store);
+        for (size_t k = 0; k < NUM_GANADORES; ++k) {
+            if (pendiente[k]) analisis.ganadores[k] = recorrido.ganadores[k];
+        }
+        // El recorrido ya trae las sumas exactas: los cambios acumulados sobran
+        sumaRecorrido = recorrido.patrimonio.suma;
+        cambios.fill(0);
+        compensacion.fill(0);
+        pendiente.fill(false);
+        ++recorridos;
+    }
+    for (size_t c = 0; c < NUM_CIUDADES; ++c) {
+        analisis.patrimonio.suma[c] = sumaRecorrido[c] + (cambios[c] + compensacion[c]);
+    }
+    return analisis;
+}
+
+size_t AgregadosPersonas::ganadoresPendientes() const {
+    size_t cantidad = 0;
+    for (bool p : pendiente) cantidad += p;
+    return cantidad;
+}
@@ -0,0 +1,74 @@
+#ifndef AGREGADOS_H
+#define AGREGADOS_H
+
+#include <array>
+#include <cstddef>
+#include "persona_store.h"
+
+/**
+ * Agregados de la población mantenidos al agregar, modificar y quitar personas.
+ *
+ * POR QUÉ: Cada consulta de longevidad, patrimonio, declarantes o mayores de 60 recorre
+ *          el conjunto completo aunque desde la última solo haya cambiado una persona.
+ * CÓMO: Un AnalisisCompleto (persona_store.h) calculado una vez y actualizado fila a fila:
+ *       sumas y conteos por ciudad y grupo se suman y restan; los ganadores se reemplazan
+ *       cuando llega una fila mejor (en empate gana la fila anterior, como en el recorrido).
+ *       Un máximo no se puede "restar": si se quita o modifica la fila ganadora, ese
+ *       ganador queda marcado y se recalcula con un recorrido en la siguiente consulta.
+ * PARA QUÉ: Responder las consultas en O(ciudades + grupos) sin recorrer las personas.
+ *
+ * Las filas son las del PersonaStore; quien lo modifica avisa cada cambio antes
+ * (restarFila) o después (sumarFila, moverFila) de hacerlo.
+ *
+ * Sumas de patrimonio: sumar y restar cada cambio sobre la suma acumulará el redondeo de
+ * cada operación y se alejará de un recorrido nuevo (opción 23). Por eso la suma es la
+ * del último recorrido más los cambios desde entonces, acumulados aparte con la suma
+ * compensada de Neumaier: sin cambios (o con cambios que se anulan) es idéntica a la del
+ * recorrido, y con cambios solo difiere en el redondeo final. Cada recorrido de consultar
+ * vuelve a tomar las sumas del recorrido y descarta los cambios.
+ */
+class AgregadosPersonas {
+public:
+    // Calcula los agregados desde cero (una pasada, acumularAnalisisCompleto)
+    void construir(const PersonaStore& store);
+
+    // La fila 'fila' es nueva o acaba de cambiar sus valores
+    void sumarFila(const PersonaStore& store, size_t fila);
+
+    // La fila 'fila' se va a quitar o modificar (sus valores siguen en el almacén)
+    void restarFila(const PersonaStore& store, size_t fila);
+
+    // La fila 'desde' pasó a la posición 'hasta' (PersonaStore::quitarFila)
+    void moverFila(const PersonaStore& store, size_t desde, size_t hasta);
+
+    /**
+     * Agregados al día.
+     *
+     * CÓMO: Sin ganadores marcados, devuelve lo acumulado; si hay alguno, un solo recorrido
+     *       los recalcula todos y de paso rehace las sumas de patrimonio (los conteos,
+     *       enteros, no se tocan).
+     */
+    const AnalisisCompleto& consultar(const PersonaStore& store);
+
+    // Ganadores que la próxima consulta debe recalcular
+    size_t ganadoresPendientes() const;
+
+    // Recorridos hechos por consultar desde construir
+    size_t recalculos() const { return recorridos; }
+
+private:
+    // Ofrece 'fila' como candidata al ganador k (valor = año de nacimiento o patrimonio)
+    void proponer(size_t k, size_t fila, double valor);
+
+    // Suma 'valor' (negativo en las bajas) a los cambios de patrimonio de la ciudad 'c'
+    void cambiarPatrimonio(CiudadId c, double valor);
+
+    AnalisisCompleto analisis;
+    std::array<double, NUM_CIUDADES> sumaRecorrido{};  // Sumas de patrimonio del último recorrido
+    std::array<double, NUM_CIUDADES> cambios{};        // Altas menos bajas desde ese recorrido
+    std::array<double, NUM_CIUDADES> compensacion{};   // Redondeo perdido al acumular 'cambios'
+    std::array<bool, NUM_GANADORES> pendiente{};
+    size_t recorridos = 0;
+};
+
+#endif // AGREGADOS_H
@@ -0,0 +1,410 @@
+#ifndef ANALITICA_H
+#define ANALITICA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ciudades.h"
+#include "fecha.h"
+#include "paralelo.h"
+#include "persona_store.h"
+#include "texto.h"
+
+// --- Análisis de las opciones 4-8 parametrizados por diseño de memoria y paso de parámetros ---
+//
+// Cada variante del parcial repite la misma lógica cambiando solo dos cosas: cómo se lee
+// un campo (método de acceso, campo de una estructura, columna) y cómo se recibe la
+// colección (referencia o copia). Aquí esas dos decisiones son políticas, y el compilador
+// genera un análisis por combinación; un mismo programa puede medir todos los diseños
+// sobre los mismos datos.
+//
+// Una política de acceso define:
+//   using Datos = ...;                                       // Colección que recorre
+//   static size_t filas(const Datos&);
+//   static int anioNacimiento(const Datos&, size_t fila);
+//   static double patrimonio(const Datos&, size_t fila);
+//   static CiudadId ciudad(const Datos&, size_t fila);
+//   static char grupoDIAN(const Datos&, size_t fila);        // 'A', 'B' o 'C'
+//   static bool declaranteRenta(const Datos&, size_t fila);
+// Un diseño nuevo solo necesita su colección y una política con estas funciones.
+//
+// Las políticas de registros completos (AccesoMetodos, AccesoCampos), que son las que
+// declara cada variante como AccesoPersona, además leen y arman una persona entera
+// (nombreDe, idDe, fechaDe, ..., crear): con ellas comun/generador.cpp imprime, exporta,
+// guarda y construye personas sin saber si son clases o estructuras.
+
+/**
+ * Registros leídos con métodos de acceso (getPatrimonio(), ...), como la Persona de clases.
+ */
+template <typename Registro>
+struct AccesoMetodos {
+    using Datos = std::vector<Registro>;
+
+    static size_t filas(const Datos& datos) { return datos.size(); }
+    static int anioNacimiento(const Datos& datos, size_t fila) { return anioDe(datos[fila]); }
+    static double patrimonio(const Datos& datos, size_t fila) { return patrimonioDe(datos[fila]); }
+    static CiudadId ciudad(const Datos& datos, size_t fila) { return ciudadDe(datos[fila]); }
+    static char grupoDIAN(const Datos& datos, size_t fila) { return grupoDe(datos[fila]); }
+    static bool declaranteRenta(const Datos& datos, size_t fila) { return declaranteDe(datos[fila]); }
+
+    // Un registro completo
+    static Texto nombreDe(const Registro& r) { return r.getNombre(); }
+    static Texto apellidoDe(const Registro& r) { return r.getApellido(); }
+    static uint64_t idDe(const Registro& r) { return r.getId(); }
+    static char grupoDe(const Registro& r) { return r.getGrupoDIAN(); }
+    static CiudadId ciudadDe(const Registro& r) { return r.getCiudadId(); }
+    static uint32_t fechaDe(const Registro& r) { return r.getFechaNacimiento(); }
+    static int anioDe(const Registro& r) { return r.getAnioNacimiento(); }
+    static int edadDe(const Registro& r) { return r.getEdad(); }
+    static double ingresosDe(const Registro& r) { return r.getIngresosAnuales(); }
+    static double patrimonioDe(const Registro& r) { return r.getPatrimonio(); }
+    static double deudasDe(const Registro& r) { return r.getDeudas(); }
+    static bool declaranteDe(const Registro& r) { return r.getDeclaranteRenta(); }
+
+    // Con el constructor completo (año y edad los calcula el constructor)
+    static Registro crear(Texto nombre, Texto apellido, uint64_t id, char grupo, CiudadId ciudad,
+                          uint32_t fecha, double ingresos, double patrimonio, double deudas, bool declarante) {
+        return Registro(nombre, apellido, id, grupo, ciudad, fecha, ingresos, patrimonio, deudas, declarante);
+    }
+};
+
+/**
+ * Registros leídos por sus campos públicos, como la Persona de estructuras o FilaCompacta.
+ */
+template <typename Registro>
+struct AccesoCampos {
+    using Datos = std::vector<Registro>;
+
+    static size_t filas(const Datos& datos) { return datos.size(); }
+    static int anioNacimiento(const Datos& datos, size_t fila) { return anioDe(datos[fila]); }
+    static double patrimonio(const Datos& datos, size_t fila) { return patrimonioDe(datos[fila]); }
+    static CiudadId ciudad(const Datos& datos, size_t fila) { return ciudadDe(datos[fila]); }
+    static char grupoDIAN(const Datos& datos, size_t fila) { return grupoDe(datos[fila]); }
+    static bool declaranteRenta(const Datos& datos, size_t fila) { return declaranteDe(datos[fila]); }
+
+    // Un registro completo (solo Persona; FilaCompacta tiene los campos de arriba)
+    static Texto nombreDe(const Registro& r) { return r.nombre; }
+    static Texto apellidoDe(const Registro& r) { return r.apellido; }
+    static uint64_t idDe(const Registro& r) { return r.id; }
+    static char grupoDe(const Registro& r) { return r.grupoDIAN; }
+    static CiudadId ciudadDe(const Registro& r) { return r.ciudadNacimiento; }
+    static uint32_t fechaDe(const Registro& r) { return r.fechaNacimiento; }
+    static int anioDe(const Registro& r) { return r.anioNacimiento; }
+    static int edadDe(const Registro& r) { return r.edad; }
+    static double ingresosDe(const Registro& r) { return r.ingresosAnuales; }
+    static double patrimonioDe(const Registro& r) { return r.patrimonio; }
+    static double deudasDe(const Registro& r) { return r.deudas; }
+    static bool declaranteDe(const Registro& r) { return r.declaranteRenta; }
+
+    // Campo por campo; año y edad se precalculan a partir de la fecha
+    static Registro crear(Texto nombre, Texto apellido, uint64_t id, char grupo, CiudadId ciudad,
+                          uint32_t fecha, double ingresos, double patrimonio, double deudas, bool declarante) {
+        Registro r;
+        r.nombre = nombre;
+        r.apellido = apellido;
+        r.id = id;
+        r.grupoDIAN = grupo;
+        r.ciudadNacimiento = ciudad;
+        r.fechaNacimiento = fecha;
+        r.anioNacimiento = static_cast<uint16_t>(anioDeFecha(fecha));
+        r.edad = static_cast<uint8_t>(calcularEdad(r.anioNacimiento));
+        r.ingresosAnuales = ingresos;
+        r.patrimonio = patrimonio;
+        r.deudas = deudas;
+        r.declaranteRenta = declarante;
+        return r;
+    }
+};
+
+/**
+ * Columnas del almacén (estructura de arreglos).
+ */
+struct AccesoColumnar {
+    using Datos = PersonaStore;
+
+    static size_t filas(const Datos& datos) { return datos.size(); }
+    static int anioNacimiento(const Datos& datos, size_t fila) { return datos.anioNacimiento[fila]; }
+    static double patrimonio(const Datos& datos, size_t fila) { return datos.patrimonio[fila]; }
+    static CiudadId ciudad(const Datos& datos, size_t fila) { return datos.ciudad[fila]; }
+    static char grupoDIAN(const Datos& datos, size_t fila) { return datos.grupoDIAN[fila]; }
+    static bool declaranteRenta(const Datos& datos, size_t fila) { return datos.declaranteRenta[fila] != 0; }
+};
+
+/**
+ * Registro compacto con solo los campos que leen los análisis (16 bytes).
+ *
+ * POR QUÉ: Separa el efecto de la disposición (arreglo de estructuras) del de su tamaño:
+ *          una Persona arrastra nombres, ID, fecha, ingresos y deudas a la caché.
+ */
+struct FilaCompacta {
+    double patrimonio;
+    uint16_t anioNacimiento;
+    CiudadId ciudadNacimiento;
+    char grupoDIAN;
+    bool declaranteRenta;
+};
+
+// Filas compactas del almacén (fila i = fila i del almacén)
+inline std::vector<FilaCompacta> construirFilasCompactas(const PersonaStore& store) {
+    std::vector<FilaCompacta> filas(store.size());
+    for (size_t i = 0; i < filas.size(); ++i) {
+        filas[i] = {store.patrimonio[i], store.anioNacimiento[i], store.ciudad[i], store.grupoDIAN[i],
+                    store.declaranteRenta[i] != 0};
+    }
+    return filas;
+}
+
+/**
+ * Bloque de FILAS_POR_BLOQUE registros con un arreglo corto por campo.
+ *
+ * POR QUÉ: Un diseño intermedio (arreglo de estructuras de arreglos, AoSoA): cada línea
+ *          de caché solo trae el campo que se lee, como en el almacén columnar, pero los
+ *          campos de una misma fila quedan a pocos bytes entre sí.
+ */
+struct BloquePersonas {
+    static const size_t FILAS_POR_BLOQUE = 16;
+
+    double patrimonio[FILAS_POR_BLOQUE];
+    uint16_t anioNacimiento[FILAS_POR_BLOQUE];
+    CiudadId ciudad[FILAS_POR_BLOQUE];
+    char grupoDIAN[FILAS_POR_BLOQUE];
+    uint8_t declaranteRenta[FILAS_POR_BLOQUE];
+};
+
+// Registros agrupados en bloques (el último puede estar incompleto)
+struct PersonasPorBloques {
+    std::vector<BloquePersonas> bloques;
+    size_t filas = 0;
+};
+
+inline PersonasPorBloques construirBloques(const PersonaStore& store) {
+    const size_t ancho = BloquePersonas::FILAS_POR_BLOQUE;
+    PersonasPorBloques datos;
+    datos.filas = store.size();
+    datos.bloques.resize((datos.filas + ancho - 1) / ancho);
+    for (size_t i = 0; i < datos.filas; ++i) {
+        BloquePersonas& bloque = datos.bloques[i / ancho];
+        size_t j = i % ancho;
+        bloque.patrimonio[j] = store.patrimonio[i];
+        bloque.anioNacimiento[j] = store.anioNacimiento[i];
+        bloque.ciudad[j] = store.ciudad[i];
+        bloque.grupoDIAN[j] = store.grupoDIAN[i];
+        bloque.declaranteRenta[j] = store.declaranteRenta[i];
+    }
+    return datos;
+}
+
+struct AccesoBloques {
+    using Datos = PersonasPorBloques;
+    static const size_t ANCHO = BloquePersonas::FILAS_POR_BLOQUE;
+
+    static size_t filas(const Datos& datos) { return datos.filas; }
+    static int anioNacimiento(const Datos& datos, size_t fila) { return datos.bloques[fila / ANCHO].anioNacimiento[fila % ANCHO]; }
+    static double patrimonio(const Datos& datos, size_t fila) { return datos.bloques[fila / ANCHO].patrimonio[fila % ANCHO]; }
+    static CiudadId ciudad(const Datos& datos, size_t fila) { return datos.bloques[fila / ANCHO].ciudad[fila % ANCHO]; }
+    static char grupoDIAN(const Datos& datos, size_t fila) { return datos.bloques[fila / ANCHO].grupoDIAN[fila % ANCHO]; }
+    static bool declaranteRenta(const Datos& datos, size_t fila) { return datos.bloques[fila / ANCHO].declaranteRenta[fila % ANCHO] != 0; }
+};
+
+// --- Políticas de paso de la colección ---
+
+// La colección se recibe por referencia constante (variantes de referencia)
+struct PasoReferencia {
+    template <typename Datos>
+    using Parametro = const Datos&;
+};
+
+// La colección se recibe por valor: cada análisis la copia (variantes de valor)
+struct PasoValor {
+    template <typename Datos>
+    using Parametro = Datos;
+};
+
+/**
+ * Análisis de las opciones 4-8 para un diseño de memoria y un paso de parámetros.
+ *
+ * POR QUÉ: generador.cpp y persona_store.cpp repetían estos recorridos, uno por diseño;
+ *          para comparar diseños hacía falta un programa por diseño, con datos y semillas
+ *          que coincidieran.
+ * CÓMO: Una sola implementación de cada reducción (reducirPorBloques, combinación en
+ *       orden de bloque, "gana la primera fila" en empates), con cada campo leído por
+ *       Acceso y la colección recibida según Paso. Devuelven filas y conteos, sin
+ *       imprimir, con los tipos de persona_store.h. generador.cpp la usa con
+ *       AccesoPersona y persona_store.cpp con AccesoColumnar, salvo los recorridos que
+ *       tienen núcleo vectorial (vectorial.h).
+ * PARA QUÉ: Resultados idénticos en todos los diseños, de modo que las diferencias de
+ *           tiempo se deban solo a la disposición en memoria y a las copias.
+ *
+ * Uso: Analitica<AccesoColumnar, PasoReferencia>::mayorPatrimonio(store)
+ */
+template <typename Acceso, typename Paso>
+class Analitica {
+public:
+    using Datos = typename Acceso::Datos;
+    using Parametro = typename Paso::template Parametro<Datos>;
+
+    // Fila de la persona más longeva (menor año de nacimiento), o SIN_FILA si no hay filas
+    static size_t masLongeva(Parametro datos) {
+        return mejoresPorGrupo<1>(datos, [](const Datos&, size_t) { return 0; }, menorAnio)[0];
+    }
+
+    static std::array<size_t, NUM_CIUDADES> longevasPorCiudad(Parametro datos) {
+        return mejoresPorGrupo<NUM_CIUDADES>(datos, Acceso::ciudad, menorAnio);
+    }
+
+    // Fila con mayor patrimonio, o SIN_FILA si no hay filas
+    static size_t mayorPatrimonio(Parametro datos) {
+        return mejoresPorGrupo<1>(datos, [](const Datos&, size_t) { return 0; }, mayorPatrimonioFila)[0];
+    }
+
+    static std::array<size_t, NUM_CIUDADES> mayorPatrimonioPorCiudad(Parametro datos) {
+        return mejoresPorGrupo<NUM_CIUDADES>(datos, Acceso::ciudad, mayorPatrimonioFila);
+    }
+
+    static std::array<size_t, 3> mayorPatrimonioPorGrupo(Parametro datos) {
+        return mejoresPorGrupo<3>(datos, grupo, mayorPatrimonioFila);
+    }
+
+    static ConteoDeclarantes declarantesPorGrupo(Parametro datos) {
+        const Datos& d = datos;
+        return reducirPorBloques(Acceso::filas(d), ConteoDeclarantes(),
+            [&d](ConteoDeclarantes& conteo, size_t inicio, size_t fin) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    int g = grupo(d, i);
+                    conteo.total[g]++;
+                    conteo.declarantes[g] += Acceso::declaranteRenta(d, i);
+                }
+            },
+            [](ConteoDeclarantes& total, const ConteoDeclarantes& parcial) { total.sumar(parcial); });
+    }
+
+    // Ciudades ordenadas por patrimonio promedio descendente
+    static std::vector<PromedioCiudad> ciudadesPorPatrimonioPromedio(Parametro datos) {
+        const Datos& d = datos;
+        PatrimonioPorCiudad acumulado = reducirPorBloques(Acceso::filas(d), PatrimonioPorCiudad(),
+            [&d](PatrimonioPorCiudad& parcial, size_t inicio, size_t fin) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    CiudadId c = Acceso::ciudad(d, i);
+                    parcial.suma[c] += Acceso::patrimonio(d, i);
+                    parcial.conteo[c]++;
+                }
+            },
+            [](PatrimonioPorCiudad& total, const PatrimonioPorCiudad& parcial) { total.sumar(parcial); });
+        return promediosOrdenados(acumulado);
+    }
+
+    static ConteoMayores60 mayores60PorGrupo(Parametro datos) {
+        const Datos& d = datos;
+        const int anioLimite = ANIO_ACTUAL - 60; // edad > 60  <=>  año < anioLimite
+        return reducirPorBloques(Acceso::filas(d), ConteoMayores60(),
+            [&d, anioLimite](ConteoMayores60& conteo, size_t inicio, size_t fin) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    int g = grupo(d, i);
+                    conteo.total[g]++;
+                    conteo.mayores60[g] += (Acceso::anioNacimiento(d, i) < anioLimite);
+                }
+            },
+            [](ConteoMayores60& total, const ConteoMayores60& parcial) { total.sumar(parcial); });
+    }
+
+    // Todos los análisis en una pasada (mismo resultado que analisisCompleto de persona_store.h)
+    static AnalisisCompleto completo(Parametro datos) {
+        AnalisisCompleto resultado;
+        acumularCompleto(datos, resultado);
+        return resultado;
+    }
+
+    /**
+     * Continúa una pasada única sobre 'acumulado'; las filas de 'datos' se numeran desde
+     * primeraFila (lotes.cpp suma así cada lote a lo ya leído).
+     */
+    static void acumularCompleto(const Datos& d, AnalisisCompleto& acumulado, size_t primeraFila = 0) {
+        const int anioLimite = ANIO_ACTUAL - 60;
+        auto menor = [](double a, double b) { return a < b; };
+        auto mayor = [](double a, double b) { return a > b; };
+
+        reducirPorBloquesSobre(acumulado, Acceso::filas(d), AnalisisCompleto(),
+            [&](AnalisisCompleto& parcial, size_t inicio, size_t fin) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    CiudadId c = Acceso::ciudad(d, i);
+                    int g = grupo(d, i);
+                    int anio = Acceso::anioNacimiento(d, i);
+                    double patri = Acceso::patrimonio(d, i);
+                    size_t fila = primeraFila + i;
+
+                    mejorar(parcial.ganadores[GANADOR_LONGEVA], fila, anio, menor);
+                    mejorar(parcial.ganadores[ganadorLongevaCiudad(c)], fila, anio, menor);
+                    mejorar(parcial.ganadores[GANADOR_PATRIMONIO], fila, patri, mayor);
+                    mejorar(parcial.ganadores[ganadorPatrimonioCiudad(c)], fila, patri, mayor);
+                    mejorar(parcial.ganadores[ganadorPatrimonioGrupo(g)], fila, patri, mayor);
+
+                    parcial.declarantes.total[g]++;
+                    parcial.declarantes.declarantes[g] += Acceso::declaranteRenta(d, i);
+                    parcial.patrimonio.suma[c] += patri;
+                    parcial.patrimonio.conteo[c]++;
+                    parcial.mayores60.total[g]++;
+                    parcial.mayores60.mayores60[g] += (anio < anioLimite);
+                }
+            },
+            [&](AnalisisCompleto& total, const AnalisisCompleto& parcial) {
+                for (size_t k = 0; k < NUM_GANADORES; ++k) {
+                    const MejorFila& candidato = parcial.ganadores[k];
+                    if (candidato.fila == SIN_FILA) continue;
+                    if (k < GANADOR_PATRIMONIO) mejorar(total.ganadores[k], candidato.fila, candidato.valor, menor);
+                    else mejorar(total.ganadores[k], candidato.fila, candidato.valor, mayor);
+                }
+                total.declarantes.sumar(parcial.declarantes);
+                total.patrimonio.sumar(parcial.patrimonio);
+                total.mayores60.sumar(parcial.mayores60);
+            });
+    }
+
+private:
+    static int grupo(const Datos& datos, size_t fila) { return indiceGrupo(Acceso::grupoDIAN(datos, fila)); }
+
+    static bool menorAnio(const Datos& datos, size_t a, size_t b) {
+        return Acceso::anioNacimiento(datos, a) < Acceso::anioNacimiento(datos, b);
+    }
+
+    static bool mayorPatrimonioFila(const Datos& datos, size_t a, size_t b) {
+        return Acceso::patrimonio(datos, a) > Acceso::patrimonio(datos, b);
+    }
+
+    // Reemplaza 'actual' por (fila, valor) si es estrictamente mejor; en empate se queda la anterior
+    template <typename Mejor>
+    static void mejorar(MejorFila& actual, size_t fila, double valor, Mejor mejor) {
+        if (actual.fila == SIN_FILA || mejor(valor, actual.valor)) {
+            actual.fila = fila;
+            actual.valor = valor;
+        }
+    }
+
+    /**
+     * Mejor fila por grupo: reducirPorBloques con un arreglo de filas por grupo.
+     *
+     * @param grupoDe grupoDe(datos, fila) devuelve el grupo (0..N-1) de la fila.
+     * @param mejor mejor(datos, a, b) indica si la fila a supera estrictamente a b.
+     */
+    template <size_t N, typename GrupoDe, typename Mejor>
+    static std::array<size_t, N> mejoresPorGrupo(const Datos& datos, GrupoDe grupoDe, Mejor mejor) {
+        std::array<size_t, N> inicial;
+        inicial.fill(SIN_FILA);
+
+        return reducirPorBloques(Acceso::filas(datos), inicial,
+            [&](std::array<size_t, N>& mejores, size_t inicio, size_t fin) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    size_t& actual = mejores[grupoDe(datos, i)];
+                    if (actual == SIN_FILA || mejor(datos, i, actual)) actual = i;
+                }
+            },
+            [&](std::array<size_t, N>& total, const std::array<size_t, N>& parcial) {
+                for (size_t g = 0; g < N; ++g) {
+                    if (parcial[g] == SIN_FILA) continue;
+                    if (total[g] == SIN_FILA || mejor(datos, parcial[g], total[g])) total[g] = parcial[g];
+                }
+            });
+    }
+};
+
+#endif // ANALITICA_H
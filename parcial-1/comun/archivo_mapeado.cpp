@@ -0,0 +1,54 @@
+#include "archivo_mapeado.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::shared_ptr<ArchivoMapeado> ArchivoMapeado::abrir(const std::string& ruta, std::string& error) {
+    int descriptor = open(ruta.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        error = "no se pudo abrir '" + ruta + "': " + std::strerror(errno);
+        return nullptr;
+    }
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close(descriptor);
+        error = "'" + ruta + "' no es un archivo regular (no se puede mapear)";
+        return nullptr;
+    }
+
+    // Un archivo vacío no se puede mapear; se representa sin datos
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void* direccion = nullptr;
+    if (bytes > 0) {
+        direccion = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (direccion == MAP_FAILED) {
+            int codigo = errno;
+            close(descriptor);
+            error = "mmap falló para '" + ruta + "': " + std::strerror(codigo);
+            return nullptr;
+        }
+    }
+    close(descriptor); // El mapeo sigue siendo válido sin el descriptor
+
+    return std::shared_ptr<ArchivoMapeado>(new ArchivoMapeado(direccion, bytes));
+}
+
+ArchivoMapeado::~ArchivoMapeado() {
+    if (direccion) munmap(direccion, bytes);
+}
+
+void ArchivoMapeado::lecturaSecuencial() const {
+    if (direccion) madvise(direccion, bytes, MADV_SEQUENTIAL);
+}
+
+void ArchivoMapeado::liberar(size_t desde, size_t hasta) const {
+    if (!direccion) return;
+    if (hasta > bytes) hasta = bytes;
+    size_t pagina = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t inicio = (desde + pagina - 1) / pagina * pagina; // Solo páginas completas del rango
+    size_t fin = (hasta == bytes) ? bytes : hasta / pagina * pagina;
+    if (inicio < fin) madvise(static_cast<char*>(direccion) + inicio, fin - inicio, MADV_DONTNEED);
+}
@@ -0,0 +1,50 @@
+#ifndef ARCHIVO_MAPEADO_H
+#define ARCHIVO_MAPEADO_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/**
+ * Archivo completo mapeado en memoria de solo lectura.
+ *
+ * POR QUÉ: El snapshot y el importador CSV leen archivos de cientos de MB; copiarlos a
+ *          un buffer duplica la memoria y el tiempo.
+ * CÓMO: mmap(PROT_READ, MAP_PRIVATE) del archivo entero; se desmapea al destruirse.
+ *       Se comparte con shared_ptr para que las vistas lo mantengan vivo.
+ * PARA QUÉ: Leer directamente de la caché de páginas del sistema, sin copias.
+ */
+class ArchivoMapeado {
+public:
+    // Mapea 'ruta'; nullptr (con el motivo en 'error') si no se pudo abrir o mapear
+    static std::shared_ptr<ArchivoMapeado> abrir(const std::string& ruta, std::string& error);
+
+    ~ArchivoMapeado();
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+    const char* datos() const { return static_cast<const char*>(direccion); }
+    size_t tam() const { return bytes; }
+
+    // Avisa al núcleo que el archivo se leerá de principio a fin (lectura anticipada agresiva)
+    void lecturaSecuencial() const;
+
+    /**
+     * Devuelve al sistema las páginas de [desde, hasta) ya leídas.
+     *
+     * POR QUÉ: Al recorrer por lotes un archivo más grande que la RAM, las páginas leídas
+     *          se acumulan en la memoria residente del proceso.
+     * CÓMO: madvise(MADV_DONTNEED) sobre las páginas completas del rango; el mapeo sigue
+     *       siendo válido (si se vuelve a leer, el contenido se carga de nuevo del archivo).
+     */
+    void liberar(size_t desde, size_t hasta) const;
+
+private:
+    ArchivoMapeado(void* direccion, size_t bytes) : direccion(direccion), bytes(bytes) {}
+
+    void* direccion;
+    size_t bytes;
+};
+
+#endif // ARCHIVO_MAPEADO_H
@@ -0,0 +1,119 @@
+#include "arena_textos.h"
+#include <string>
+
+/**
+ * Hash FNV-1a de 64 bits.
+ *
+ * POR QUÉ: Los textos son cortos (nombres y apellidos); FNV-1a es simple y reparte bien.
+ */
+static inline uint64_t hashTexto(const char* datos, size_t largo) {
+    uint64_t h = 1469598103934665603ULL;
+    for (size_t i = 0; i < largo; ++i) {
+        h ^= static_cast<unsigned char>(datos[i]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+/**
+ * Copia el texto al bloque actual, o a uno nuevo si no cabe.
+ *
+ * POR QUÉ: Con bloques de TAM_BLOQUE desde el primer texto, las 16 particiones reservan
+ *          1 MB aunque el conjunto tenga pocos nombres distintos.
+ * CÓMO: Los bloques crecen al doble desde TAM_BLOQUE_INICIAL; la memoria sin usar queda
+ *       acotada por el último bloque de cada partición.
+ */
+const char* ArenaTextos::Particion::copiar(const char* datos, size_t largo) {
+    if (largo > disponibles) {
+        size_t tam = (largo > tamSiguiente) ? largo : tamSiguiente;
+        if (tamSiguiente < TAM_BLOQUE) tamSiguiente *= 2;
+        bloques.emplace_back(new char[tam]);
+        libre = bloques.back().get();
+        disponibles = tam;
+        bytesBloques += tam;
+    }
+    char* destino = libre;
+    std::memcpy(destino, datos, largo);
+    libre += largo;
+    disponibles -= largo;
+    return destino;
+}
+
+// Duplica la tabla (o crea la inicial) y reubica las ranuras ocupadas
+void ArenaTextos::Particion::crecer() {
+    std::vector<Ranura> anterior;
+    anterior.swap(tabla);
+    tabla.assign(anterior.empty() ? 64 : anterior.size() * 2, Ranura{nullptr, 0, 0});
+    size_t mascara = tabla.size() - 1;
+    for (const Ranura& r : anterior) {
+        if (!r.datos) continue;
+        size_t pos = r.hash & mascara;
+        while (tabla[pos].datos) pos = (pos + 1) & mascara;
+        tabla[pos] = r;
+    }
+}
+
+/**
+ * Implementación de internar.
+ *
+ * CÓMO: Los 4 bits altos del hash eligen la partición y los bajos la ranura (sondeo lineal).
+ */
+Texto ArenaTextos::internar(const char* datos, size_t largo) {
+    uint64_t h = hashTexto(datos, largo);
+    uint32_t h32 = static_cast<uint32_t>(h);
+    Particion& p = particiones[h >> 60];
+
+    std::lock_guard<std::mutex> bloqueo(p.cerrojo);
+    if ((p.cantidad + 1) * 2 > p.tabla.size()) p.crecer();
+
+    size_t mascara = p.tabla.size() - 1;
+    size_t pos = h32 & mascara;
+    while (p.tabla[pos].datos) {
+        const Ranura& r = p.tabla[pos];
+        if (r.hash == h32 && r.largo == largo && (largo == 0 || std::memcmp(r.datos, datos, largo) == 0)) {
+            return Texto(r.datos, r.largo);
+        }
+        pos = (pos + 1) & mascara;
+    }
+
+    // Un texto vacío ocupa un byte, para que su dirección no sea nula (marca de ranura vacía)
+    const char* guardado = (largo > 0) ? p.copiar(datos, largo) : p.copiar("", 1);
+    p.tabla[pos] = Ranura{guardado, static_cast<uint32_t>(largo), h32};
+    ++p.cantidad;
+    return Texto(guardado, largo);
+}
+
+size_t ArenaTextos::textos() const {
+    size_t total = 0;
+    for (const Particion& p : particiones) {
+        std::lock_guard<std::mutex> bloqueo(p.cerrojo);
+        total += p.cantidad;
+    }
+    return total;
+}
+
+size_t ArenaTextos::memoriaBytes() const {
+    size_t total = 0;
+    for (const Particion& p : particiones) {
+        std::lock_guard<std::mutex> bloqueo(p.cerrojo);
+        total += p.bytesBloques + p.tabla.capacity() * sizeof(Ranura) +
+                 p.bloques.capacity() * sizeof(std::unique_ptr<char[]>);
+    }
+    return total;
+}
+
+/**
+ * Implementación de bytesComoString.
+ *
+ * CÓMO: libstdc++ guarda hasta 15 caracteres dentro del objeto; los demás piden
+ *       largo + 1 bytes a malloc, que agrega 8 de cabecera y redondea a 16 (mínimo 32).
+ */
+size_t bytesComoString(size_t largo) {
+    const size_t EN_LINEA = 15;
+    size_t bytes = sizeof(std::string);
+    if (largo > EN_LINEA) {
+        size_t bloque = (largo + 1 + 8 + 15) & ~static_cast<size_t>(15);
+        bytes += (bloque < 32) ? 32 : bloque;
+    }
+    return bytes;
+}
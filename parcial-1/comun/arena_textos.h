@@ -0,0 +1,103 @@
+#ifndef ARENA_TEXTOS_H
+#define ARENA_TEXTOS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "texto.h"
+
+/**
+ * Arena de textos internados (nombres y apellidos).
+ *
+ * POR QUÉ: Con un std::string por campo, 2M personas son millones de asignaciones
+ *          (los apellidos compuestos no caben en el búfer interno del string) y liberar
+ *          el conjunto recorre y destruye cada uno.
+ * CÓMO: Cada texto distinto se copia una sola vez en bloques grandes (asignación por
+ *       avance de puntero) y se entrega como Texto; una tabla hash de direccionamiento
+ *       abierto encuentra los repetidos. La arena se divide en particiones, cada una con
+ *       su cerrojo, tabla y bloques, para que varios hilos internen a la vez.
+ * PARA QUÉ: Personas sin memoria dinámica propia: liberar un conjunto es liberar su
+ *           vector y los pocos bloques de la arena, sin importar cuántas personas tenga.
+ *
+ * Los Texto entregados son válidos mientras viva la arena. Dos textos iguales internados
+ * en la misma arena comparten la misma dirección.
+ */
+class ArenaTextos {
+public:
+    // Tamaño del primer bloque de texto de cada partición; cada bloque nuevo duplica el
+    // anterior hasta TAM_BLOQUE (los textos más largos reciben un bloque propio)
+    static const size_t TAM_BLOQUE_INICIAL = 1 << 10;
+    static const size_t TAM_BLOQUE = 64 << 10;
+
+    ArenaTextos() = default;
+    ArenaTextos(const ArenaTextos&) = delete;
+    ArenaTextos& operator=(const ArenaTextos&) = delete;
+
+    /**
+     * Devuelve el texto guardado igual a 'texto', guardándolo si es nuevo.
+     *
+     * CÓMO: El hash elige la partición y la ranura; solo se bloquea esa partición.
+     *       Seguro para llamar desde varios hilos.
+     */
+    Texto internar(const char* datos, size_t largo);
+    Texto internar(const Texto& texto) { return internar(texto.datos, texto.largo); }
+
+    // Textos distintos guardados
+    size_t textos() const;
+
+    // Memoria de la arena en bytes: bloques de texto y tablas hash
+    size_t memoriaBytes() const;
+
+private:
+    static const size_t NUM_PARTICIONES = 16;
+
+    // Ranura de la tabla hash; datos == nullptr marca una ranura vacía
+    struct Ranura {
+        const char* datos;
+        uint32_t largo;
+        uint32_t hash;   // 32 bits bajos del hash (descarta comparaciones)
+    };
+
+    struct Particion {
+        mutable std::mutex cerrojo;
+        std::vector<Ranura> tabla;                    // Capacidad potencia de 2, carga <= 0.5
+        size_t cantidad = 0;
+        std::vector<std::unique_ptr<char[]>> bloques;
+        char* libre = nullptr;                        // Siguiente byte libre del bloque actual
+        size_t disponibles = 0;                       // Bytes libres del bloque actual
+        size_t bytesBloques = 0;
+        size_t tamSiguiente = TAM_BLOQUE_INICIAL;     // Tamaño del próximo bloque
+
+        const char* copiar(const char* datos, size_t largo);
+        void crecer();
+    };
+
+    std::array<Particion, NUM_PARTICIONES> particiones;
+};
+
+/**
+ * Memoria de los campos de texto de una colección, frente a un std::string por campo.
+ *
+ * POR QUÉ: El Monitor informa cuánta memoria se ahorra al guardar los textos en una arena.
+ * CÓMO: bytesComoString suma sizeof(std::string) por campo más el bloque de memoria
+ *       dinámica de los que no caben en su búfer interno; bytesActuales suma sizeof(Texto)
+ *       por campo y la arena propia del conjunto.
+ */
+struct UsoTextos {
+    size_t campos = 0;
+    size_t bytesComoString = 0;
+    size_t bytesActuales = 0;
+
+    // Con signo: en conjuntos pequeños la arena puede ocupar más que los std::string
+    long long ahorro() const {
+        return static_cast<long long>(bytesComoString) - static_cast<long long>(bytesActuales);
+    }
+};
+
+// Bytes que ocuparía un std::string de 'largo' caracteres (objeto y bloque de malloc, libstdc++)
+size_t bytesComoString(size_t largo);
+
+#endif // ARENA_TEXTOS_H
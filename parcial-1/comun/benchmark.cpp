@@ -0,0 +1,142 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>   // snprintf
+#include <fcntl.h>  // open
+#include <unistd.h> // dup, dup2, close
+
+ResumenTiempos resumirTiempos(std::vector<double> tiempos) {
+    ResumenTiempos resumen;
+    if (tiempos.empty()) return resumen;
+    std::sort(tiempos.begin(), tiempos.end());
+
+    size_t n = tiempos.size();
+    resumen.muestras = n;
+    resumen.minimo = tiempos.front();
+    resumen.maximo = tiempos.back();
+    resumen.mediana = (n % 2 == 1) ? tiempos[n / 2] : (tiempos[n / 2 - 1] + tiempos[n / 2]) / 2;
+    size_t rango = static_cast<size_t>(std::ceil(0.95 * static_cast<double>(n)));
+    resumen.p95 = tiempos[std::max<size_t>(rango, 1) - 1];
+
+    double suma = 0;
+    for (double t : tiempos) suma += t;
+    resumen.media = suma / static_cast<double>(n);
+    if (n > 1) {
+        double cuadrados = 0;
+        for (double t : tiempos) cuadrados += (t - resumen.media) * (t - resumen.media);
+        resumen.desviacion = std::sqrt(cuadrados / static_cast<double>(n - 1));
+    }
+    return resumen;
+}
+
+SalidaSilenciada::SalidaSilenciada() {
+    std::cout.flush();
+    int nula = open("/dev/null", O_WRONLY);
+    if (nula >= 0) {
+        salidaOriginal = dup(1);
+        dup2(nula, 1);
+        close(nula);
+    }
+    bufferOriginal = std::cout.rdbuf(nullptr);
+}
+
+SalidaSilenciada::~SalidaSilenciada() {
+    std::cout.rdbuf(bufferOriginal);
+    std::cout.clear();
+    if (salidaOriginal >= 0) {
+        dup2(salidaOriginal, 1);
+        close(salidaOriginal);
+    }
+}
+
+std::vector<double> medirRepeticiones(const std::function<void()>& medicion, int calentamiento,
+                                      int repeticiones, ConteoAsignaciones& asignaciones) {
+    std::vector<double> tiempos;
+    tiempos.reserve(static_cast<size_t>(std::max(repeticiones, 0)));
+    SalidaSilenciada silencio;
+    for (int i = 0; i < calentamiento; ++i) medicion();
+    for (int i = 0; i < repeticiones; ++i) {
+        ConteoAsignaciones antes = leerAsignaciones();
+        auto inicio = std::chrono::steady_clock::now();
+        medicion();
+        tiempos.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count());
+        asignaciones = leerAsignaciones() - antes;
+    }
+    return tiempos;
+}
+
+// Campo de texto CSV, entre comillas si contiene separadores o comillas
+static std::string campoCsv(const std::string& texto) {
+    if (texto.find_first_of(",\"\n") == std::string::npos) return texto;
+    std::string campo = "\"";
+    for (char c : texto) {
+        if (c == '"') campo += '"';
+        campo += c;
+    }
+    return campo + "\"";
+}
+
+// Cadena JSON con las comillas, barras y caracteres de control escapados
+static std::string cadenaJson(const std::string& texto) {
+    std::string cadena = "\"";
+    for (unsigned char c : texto) {
+        if (c == '"' || c == '\\') {
+            cadena += '\\';
+            cadena += static_cast<char>(c);
+        } else if (c < 0x20) {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            cadena += escape;
+        } else {
+            cadena += static_cast<char>(c);
+        }
+    }
+    return cadena + "\"";
+}
+
+// Milisegundos con 4 decimales (los análisis pequeños duran fracciones de ms)
+static std::string milisegundos(double ms) {
+    char texto[32];
+    snprintf(texto, sizeof(texto), "%.4f", ms);
+    return texto;
+}
+
+void escribirResultadosCsv(std::ostream& salida, const std::vector<ResultadoBenchmark>& resultados, bool cabecera) {
+    if (cabecera) {
+        salida << "variante,personas,semilla,hilos,simd,compilacion,analisis,modo,calentamiento,repeticiones,"
+                  "min_ms,mediana_ms,p95_ms,max_ms,media_ms,desviacion_ms,asignaciones,bytes_asignados\n";
+    }
+    for (const auto& r : resultados) {
+        salida << campoCsv(r.variante) << "," << r.personas << "," << r.semilla << "," << r.hilos << ","
+               << r.simd << "," << campoCsv(r.compilacion) << "," << r.analisis << "," << r.modo << ","
+               << r.calentamiento << "," << r.tiempos.muestras << "," << milisegundos(r.tiempos.minimo) << ","
+               << milisegundos(r.tiempos.mediana) << "," << milisegundos(r.tiempos.p95) << ","
+               << milisegundos(r.tiempos.maximo) << "," << milisegundos(r.tiempos.media) << ","
+               << milisegundos(r.tiempos.desviacion) << "," << r.asignaciones.asignaciones << ","
+               << r.asignaciones.bytes << "\n";
+    }
+}
+
+void escribirResultadosJson(std::ostream& salida, const std::vector<ResultadoBenchmark>& resultados) {
+    salida << "[";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoBenchmark& r = resultados[i];
+        salida << (i == 0 ? "\n" : ",\n")
+               << "  {\"variante\": " << cadenaJson(r.variante) << ", \"personas\": " << r.personas
+               << ", \"semilla\": " << r.semilla << ", \"hilos\": " << r.hilos
+               << ", \"simd\": " << cadenaJson(r.simd) << ", \"compilacion\": " << cadenaJson(r.compilacion)
+               << ", \"analisis\": " << cadenaJson(r.analisis)
+               << ", \"modo\": " << cadenaJson(r.modo) << ", \"calentamiento\": " << r.calentamiento
+               << ", \"repeticiones\": " << r.tiempos.muestras
+               << ", \"min_ms\": " << milisegundos(r.tiempos.minimo)
+               << ", \"mediana_ms\": " << milisegundos(r.tiempos.mediana)
+               << ", \"p95_ms\": " << milisegundos(r.tiempos.p95)
+               << ", \"max_ms\": " << milisegundos(r.tiempos.maximo)
+               << ", \"media_ms\": " << milisegundos(r.tiempos.media)
+               << ", \"desviacion_ms\": " << milisegundos(r.tiempos.desviacion)
+               << ", \"asignaciones\": " << r.asignaciones.asignaciones
+               << ", \"bytes_asignados\": " << r.asignaciones.bytes << "}";
+    }
+    salida << (resultados.empty() ? "]\n" : "\n]\n");
+}
@@ -0,0 +1,99 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "contador_asignaciones.h"
+
+// --- Benchmark no interactivo: repeticiones, estadísticas y salida JSON/CSV ---
+
+/**
+ * Resumen de los tiempos de varias repeticiones de una medición.
+ *
+ * POR QUÉ: Una sola corrida por análisis (como las tablas del README) no muestra la
+ *          variación entre corridas, así que no distingue una regresión del ruido.
+ * PARA QUÉ: Comparar variantes y tamaños con la mediana y acotar la dispersión con
+ *           el percentil 95 y la desviación estándar.
+ */
+struct ResumenTiempos {
+    size_t muestras = 0;
+    double minimo = 0;
+    double mediana = 0;
+    double p95 = 0;        // Percentil 95 por rango más cercano
+    double maximo = 0;
+    double media = 0;
+    double desviacion = 0; // Desviación estándar muestral (n - 1)
+};
+
+// Resumen de 'tiempos' (en ms); todo en cero si no hay muestras
+ResumenTiempos resumirTiempos(std::vector<double> tiempos);
+
+/**
+ * Silencia la salida estándar mientras existe el objeto.
+ *
+ * POR QUÉ: Los listados de los análisis no deben contar en la medición ni ensuciar la
+ *          salida del benchmark (que puede ser el JSON o el CSV).
+ * CÓMO: Desconecta std::cout y apunta el descriptor 1 a /dev/null (BufferSalida escribe
+ *       con write(2)); el destructor restaura ambos.
+ */
+class SalidaSilenciada {
+public:
+    SalidaSilenciada();
+    ~SalidaSilenciada();
+
+    SalidaSilenciada(const SalidaSilenciada&) = delete;
+    SalidaSilenciada& operator=(const SalidaSilenciada&) = delete;
+
+private:
+    int salidaOriginal = -1;
+    std::streambuf* bufferOriginal = nullptr;
+};
+
+/**
+ * Ejecuta 'medicion' con la salida silenciada: 'calentamiento' veces sin medir y
+ * 'repeticiones' veces midiendo cada una con steady_clock.
+ *
+ * @param asignaciones Asignaciones dinámicas de la última repetición medida.
+ * @return Tiempo de cada repetición en milisegundos.
+ */
+std::vector<double> medirRepeticiones(const std::function<void()>& medicion, int calentamiento,
+                                      int repeticiones, ConteoAsignaciones& asignaciones);
+
+// Compilador y flags de la variante; los define su Makefile (BANDERAS)
+#ifndef BANDERAS_COMPILACION
+#define BANDERAS_COMPILACION "desconocidas"
+#endif
+
+/**
+ * Una fila de resultados: un análisis, en un modo, sobre un conjunto de datos.
+ *
+ * CÓMO: Cada fila lleva también la variante, el tamaño y la configuración, para que los
+ *       resultados de varias ejecuciones se puedan concatenar y comparar sin contexto.
+ */
+struct ResultadoBenchmark {
+    std::string variante;     // p. ej. clases_referencia
+    size_t personas = 0;      // Tamaño del conjunto
+    uint64_t semilla = 0;
+    unsigned hilos = 0;
+    std::string simd;         // Nivel de los núcleos vectoriales
+    std::string compilacion;  // Compilador y flags (BANDERAS_COMPILACION)
+    std::string analisis;     // Clave del análisis (o de la preparación: generar, columnar)
+    std::string modo;         // objetos, columnar o preparacion
+    int calentamiento = 0;
+    ResumenTiempos tiempos;
+    ConteoAsignaciones asignaciones;  // De una repetición
+};
+
+// Escribe los resultados como CSV (una fila por resultado, con cabecera si se pide)
+void escribirResultadosCsv(std::ostream& salida, const std::vector<ResultadoBenchmark>& resultados,
+                           bool cabecera = true);
+
+// Escribe los resultados como un arreglo JSON de objetos planos
+void escribirResultadosJson(std::ostream& salida, const std::vector<ResultadoBenchmark>& resultados);
+
+#endif // BENCHMARK_H
@@ -0,0 +1,121 @@
+#include "buffer_salida.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/wait.h>  // WIFEXITED, WEXITSTATUS
+#include <unistd.h>
+
+BufferSalida::BufferSalida(int descriptor, size_t capacidad)
+    : buffer(capacidad > 64 ? capacidad : 64), descriptor(descriptor) {
+    // Lo que iostream/stdio tengan pendiente debe salir antes que nuestras escrituras
+    std::cout.flush();
+    std::fflush(stdout);
+}
+
+BufferSalida::BufferSalida(const std::string& destino, size_t capacidad)
+    : BufferSalida(1, capacidad) {
+    if (destino.empty() || destino == "-") return;
+
+    senalAnterior = signal(SIGPIPE, SIG_IGN);
+    senalIgnorada = true;
+    if (destino[0] == '|') {
+        tuberia = popen(destino.c_str() + 1, "w");
+        descriptor = tuberia ? fileno(tuberia) : -1;
+    } else {
+        descriptor = open(destino.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        propio = descriptor >= 0;
+    }
+}
+
+BufferSalida::~BufferSalida() {
+    cerrar();
+}
+
+bool BufferSalida::cerrar() {
+    if (cerrado) return valido();
+    vaciar();
+    cerrado = true;
+    if (tuberia) {
+        int estado = pclose(tuberia);
+        tuberia = nullptr;
+        codigo = (estado != -1 && WIFEXITED(estado)) ? WEXITSTATUS(estado) : -1;
+        if (codigo != 0) error = true;
+    } else if (propio) {
+        if (close(descriptor) != 0) error = true;
+    }
+    if (senalIgnorada) {
+        signal(SIGPIPE, senalAnterior);
+        senalIgnorada = false;
+    }
+    return valido();
+}
+
+void BufferSalida::agregar(const char* datos, size_t longitud) {
+    // Lo que no cabe se copia por partes del tamaño del buffer
+    while (longitud > buffer.size() - usados) {
+        size_t parte = buffer.size() - usados;
+        std::memcpy(buffer.data() + usados, datos, parte);
+        usados += parte;
+        vaciar();
+        datos += parte;
+        longitud -= parte;
+    }
+    std::memcpy(buffer.data() + usados, datos, longitud);
+    usados += longitud;
+}
+
+void BufferSalida::agregarEntero(uint64_t valor) {
+    char cifras[20];
+    int n = 0;
+    do {
+        cifras[n++] = static_cast<char>('0' + valor % 10);
+        valor /= 10;
+    } while (valor != 0);
+
+    if (static_cast<size_t>(n) > buffer.size() - usados) vaciar();
+    while (n > 0) buffer[usados++] = cifras[--n];
+}
+
+void BufferSalida::agregarDecimal2(double valor) {
+    double centavos = std::fabs(valor) * 100.0;
+    double fraccion = centavos - std::floor(centavos);
+
+    // Fuera de rango de uint64_t, no finito o casi en la mitad de un centavo: formateo exacto
+    if (!std::isfinite(valor) || centavos >= 1e18 || std::fabs(fraccion - 0.5) < 1e-6) {
+        char texto[64];
+        int n = std::snprintf(texto, sizeof(texto), "%.2f", valor);
+        if (n > 0) agregar(texto, std::min(static_cast<size_t>(n), sizeof(texto) - 1));
+        return;
+    }
+
+    uint64_t redondeado = static_cast<uint64_t>(std::llround(centavos));
+    if (std::signbit(valor)) agregar('-'); // Incluye -0.00, como printf
+    agregarEntero(redondeado / 100);
+    agregar('.');
+    agregar(static_cast<char>('0' + redondeado / 10 % 10));
+    agregar(static_cast<char>('0' + redondeado % 10));
+}
+
+void BufferSalida::vaciar() {
+    const char* datos = buffer.data();
+    size_t pendiente = usados;
+    usados = 0;
+    if (descriptor < 0 || error || cerrado) return;
+
+    // write(2) puede escribir menos de lo pedido (pipes) o interrumpirse por una señal
+    while (pendiente > 0) {
+        ssize_t n = write(descriptor, datos, pendiente);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            cerradoPorLector = (errno == EPIPE);
+            error = true;
+            return;
+        }
+        datos += n;
+        pendiente -= static_cast<size_t>(n);
+        escritos += static_cast<size_t>(n);
+    }
+}
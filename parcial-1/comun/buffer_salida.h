@@ -0,0 +1,114 @@
+#ifndef BUFFER_SALIDA_H
+#define BUFFER_SALIDA_H
+
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "texto.h"
+
+/**
+ * Buffer de salida en bloque sobre un descriptor de archivo.
+ *
+ * POR QUÉ: Listar 2M personas con std::cout tarda decenas de segundos: cada campo pasa
+ *          por el formateo de iostream (setprecision, locale) y por la sincronización con stdio.
+ * CÓMO: Las filas se escriben en un buffer grande y reutilizable, con formateo propio de
+ *       enteros y de decimales con 2 cifras; al llenarse se vacía con pocas llamadas a write(2).
+ * PARA QUÉ: Volcar listados completos en menos de un segundo a la terminal, a un archivo o a un pipe.
+ */
+class BufferSalida {
+public:
+    // Capacidad por defecto: 1 MiB (un write(2) por cada ~15 000 filas de resumen)
+    static const size_t CAPACIDAD_DEFECTO = 1 << 20;
+
+    /**
+     * Crea el buffer sobre un descriptor ya abierto (p. ej. 1 = salida estándar).
+     *
+     * POR QUÉ: La terminal no se abre ni se cierra; solo se escribe en ella.
+     * CÓMO: No toma posesión del descriptor.
+     */
+    explicit BufferSalida(int descriptor = 1, size_t capacidad = CAPACIDAD_DEFECTO);
+
+    /**
+     * Abre un destino por ruta y escribe en él.
+     *
+     * POR QUÉ: Redirigir listados sin depender de la shell.
+     * CÓMO: "-" o vacío = salida estándar; "|comando" = pipe hacia el comando (popen);
+     *       cualquier otra ruta se abre con open(2) (archivo regular o FIFO, se trunca).
+     * PARA QUÉ: Opción del menú que exporta el resumen a un archivo o a otro programa.
+     */
+    explicit BufferSalida(const std::string& destino, size_t capacidad = CAPACIDAD_DEFECTO);
+
+    // Vacía lo pendiente y cierra el destino si lo abrió este objeto
+    ~BufferSalida();
+
+    /**
+     * Vacía lo pendiente y cierra el destino (si lo abrió este objeto) antes de destruirlo.
+     *
+     * POR QUÉ: Con un pipe, el error solo se conoce al escribir o al esperar al comando.
+     * CÓMO: pclose espera al comando; un código de salida distinto de cero o un lector
+     *       que cerró el pipe antes de tiempo (EPIPE) cuentan como error.
+     * @return valido() después de cerrar.
+     */
+    bool cerrar();
+
+    BufferSalida(const BufferSalida&) = delete;
+    BufferSalida& operator=(const BufferSalida&) = delete;
+
+    // false si el destino no se pudo abrir o falló una escritura
+    bool valido() const { return descriptor >= 0 && !error; }
+
+    // Bytes entregados a write(2) hasta el momento
+    size_t bytesEscritos() const { return escritos; }
+
+    // true si el lector del pipe o FIFO lo cerró antes de recibir todo (EPIPE)
+    bool lectorCerro() const { return cerradoPorLector; }
+
+    // Código de salida del comando ("|comando"), disponible después de cerrar(); -1 si no terminó normalmente
+    int codigoComando() const { return codigo; }
+
+    void agregar(const char* datos, size_t longitud);
+    void agregar(const char* texto) { agregar(texto, std::strlen(texto)); }
+    void agregar(const std::string& texto) { agregar(texto.data(), texto.size()); }
+    void agregar(const Texto& texto) { agregar(texto.datos, texto.largo); }
+    void agregar(char c) {
+        if (usados == buffer.size()) vaciar();
+        buffer[usados++] = c;
+    }
+
+    // Entero sin signo en base 10
+    void agregarEntero(uint64_t valor);
+
+    /**
+     * Decimal en punto fijo con 2 cifras, igual que std::fixed << std::setprecision(2).
+     *
+     * CÓMO: Redondea a centavos con aritmética entera; los valores que caen casi en la mitad
+     *       de un centavo (donde x * 100 pierde exactitud) se delegan a snprintf.
+     */
+    void agregarDecimal2(double valor);
+
+    // Entrega a write(2) todo lo acumulado
+    void vaciar();
+
+private:
+    std::vector<char> buffer;
+    size_t usados = 0;
+    size_t escritos = 0;
+    int descriptor = -1;
+    bool propio = false;       // El descriptor lo abrió este objeto (se cierra al destruir)
+    FILE* tuberia = nullptr;   // Pipe abierto con popen ("|comando")
+    bool error = false;
+    bool cerrado = false;           // cerrar() ya se llamó
+    bool cerradoPorLector = false;  // write(2) falló con EPIPE
+    int codigo = 0;                 // Código de salida del comando del pipe
+
+    // SIGPIPE ignorada mientras se escribe en un destino propio (pipe o FIFO): sin esto,
+    // un lector que termina antes (p. ej. "|head") mata al programa en lugar de dar EPIPE
+    bool senalIgnorada = false;
+    void (*senalAnterior)(int) = SIG_DFL;
+};
+
+#endif // BUFFER_SALIDA_H
@@ -0,0 +1,26 @@
+#include "ciudades.h"
+#include <algorithm> // std::sort
+
+const std::vector<std::string> ciudadesColombia = {
+    "Bogotá", "Medellín", "Cali", "Barranquilla", "Cartagena", "Bucaramanga", "Pereira", "Santa Marta", "Cúcuta", "Ibagué",
+    "Manizales", "Pasto", "Neiva", "Villavicencio", "Armenia", "Sincelejo", "Valledupar", "Montería", "Popayán", "Tunja"
+};
+
+CiudadId buscarCiudad(const std::string& nombre) {
+    for (size_t c = 0; c < ciudadesColombia.size(); ++c) {
+        if (ciudadesColombia[c] == nombre) return static_cast<CiudadId>(c);
+    }
+    return CIUDAD_INVALIDA;
+}
+
+const std::vector<CiudadId>& ciudadesPorNombre() {
+    // Se calcula una sola vez: la tabla es constante
+    static const std::vector<CiudadId> orden = [] {
+        std::vector<CiudadId> ids(NUM_CIUDADES);
+        for (size_t c = 0; c < NUM_CIUDADES; ++c) ids[c] = static_cast<CiudadId>(c);
+        std::sort(ids.begin(), ids.end(),
+            [](CiudadId a, CiudadId b) { return ciudadesColombia[a] < ciudadesColombia[b]; });
+        return ids;
+    }();
+    return orden;
+}
@@ -0,0 +1,41 @@
+#ifndef CIUDADES_H
+#define CIUDADES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Diccionario de ciudades de nacimiento.
+ *
+ * POR QUÉ: Solo existen 20 ciudades posibles; guardar una copia del nombre por persona
+ *          desperdicia memoria y obliga a comparar cadenas al agrupar.
+ * CÓMO: Cada persona guarda un CiudadId (1 byte) que indexa una tabla de nombres compartida.
+ * PARA QUÉ: Agrupar por ciudad con indexación directa de arreglos.
+ */
+using CiudadId = uint8_t;
+
+// Principales ciudades colombianas (la posición en la tabla es el CiudadId)
+extern const std::vector<std::string> ciudadesColombia;
+
+// Número de ciudades del diccionario (tamaño de los arreglos por ciudad)
+const size_t NUM_CIUDADES = 20;
+
+// Valor devuelto por buscarCiudad cuando el nombre no está en el diccionario
+const CiudadId CIUDAD_INVALIDA = 0xFF;
+
+// Nombre de una ciudad a partir de su identificador
+inline const std::string& nombreCiudad(CiudadId id) { return ciudadesColombia[id]; }
+
+// Identificador de una ciudad a partir de su nombre, o CIUDAD_INVALIDA
+CiudadId buscarCiudad(const std::string& nombre);
+
+/**
+ * Identificadores ordenados alfabéticamente por nombre.
+ *
+ * PARA QUÉ: Imprimir los resultados por ciudad en el mismo orden que un std::map de nombres.
+ */
+const std::vector<CiudadId>& ciudadesPorNombre();
+
+#endif // CIUDADES_H
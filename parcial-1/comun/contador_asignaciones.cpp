@@ -0,0 +1,111 @@
+#include "contador_asignaciones.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <malloc.h>  // malloc_usable_size
+
+/**
+ * Contadores de un hilo.
+ *
+ * POR QUÉ: Con contadores globales, cada new de los hilos de generación o análisis
+ *          es una escritura atómica sobre la misma línea de caché.
+ * CÓMO: Cada hilo cuenta en su copia (thread_local, sin constructor dinámico: no asigna
+ *       memoria al crearse) y al terminar la suma a los totales de los hilos retirados.
+ */
+struct ContadorHilo {
+    size_t asignaciones = 0;
+    size_t bytes = 0;
+    size_t liberaciones = 0;
+
+    ~ContadorHilo();
+};
+
+// Totales de los hilos que ya terminaron (relaxed: solo se leen como totales)
+static std::atomic<size_t> asignacionesRetiradas(0);
+static std::atomic<size_t> bytesRetirados(0);
+static std::atomic<size_t> liberacionesRetiradas(0);
+
+ContadorHilo::~ContadorHilo() {
+    asignacionesRetiradas.fetch_add(asignaciones, std::memory_order_relaxed);
+    bytesRetirados.fetch_add(bytes, std::memory_order_relaxed);
+    liberacionesRetiradas.fetch_add(liberaciones, std::memory_order_relaxed);
+    asignaciones = bytes = liberaciones = 0;  // Por si el hilo asigna después de destruirlo
+}
+
+static thread_local ContadorHilo contadorHilo;
+
+// Seguimiento opcional de memoria viva
+static std::atomic<bool> seguimiento(false);
+static std::atomic<long long> vivos(0);
+static std::atomic<long long> pico(0);
+
+ConteoAsignaciones leerAsignaciones() {
+    ConteoAsignaciones conteo;
+    conteo.asignaciones = asignacionesRetiradas.load(std::memory_order_relaxed) + contadorHilo.asignaciones;
+    conteo.bytes = bytesRetirados.load(std::memory_order_relaxed) + contadorHilo.bytes;
+    conteo.liberaciones = liberacionesRetiradas.load(std::memory_order_relaxed) + contadorHilo.liberaciones;
+    return conteo;
+}
+
+void activarSeguimientoAsignaciones() {
+    seguimiento.store(true, std::memory_order_relaxed);
+}
+
+bool seguimientoAsignacionesActivo() {
+    return seguimiento.load(std::memory_order_relaxed);
+}
+
+long long bytesVivos() {
+    return vivos.load(std::memory_order_relaxed);
+}
+
+long long picoBytesVivos() {
+    return pico.load(std::memory_order_relaxed);
+}
+
+void reiniciarPicoBytesVivos() {
+    pico.store(vivos.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+/**
+ * Reemplazo del operator new global.
+ *
+ * POR QUÉ: Es el punto por el que pasan todas las asignaciones de la biblioteca estándar.
+ * CÓMO: Cuenta la llamada en el hilo y delega en malloc; new[] y delete[] de la biblioteca
+ *       estándar terminan llamando a estas funciones. Con el seguimiento activo también
+ *       suma el bloque a los bytes vivos y actualiza el pico.
+ */
+void* operator new(std::size_t tam) {
+    contadorHilo.asignaciones++;
+    contadorHilo.bytes += tam;
+    if (tam == 0) tam = 1;
+    void* p = std::malloc(tam);
+    if (!p) throw std::bad_alloc();
+
+    if (seguimiento.load(std::memory_order_relaxed)) {
+        long long bloque = static_cast<long long>(malloc_usable_size(p));
+        long long actual = vivos.fetch_add(bloque, std::memory_order_relaxed) + bloque;
+        long long maximo = pico.load(std::memory_order_relaxed);
+        while (actual > maximo && !pico.compare_exchange_weak(maximo, actual, std::memory_order_relaxed)) {
+        }
+    }
+    return p;
+}
+
+// Descuenta el bloque de los bytes vivos (con el seguimiento activo) y lo libera
+static void liberar(void* p) noexcept {
+    if (!p) return;
+    if (seguimiento.load(std::memory_order_relaxed)) {
+        contadorHilo.liberaciones++;
+        vivos.fetch_sub(static_cast<long long>(malloc_usable_size(p)), std::memory_order_relaxed);
+    }
+    std::free(p);
+}
+
+void operator delete(void* p) noexcept {
+    liberar(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    liberar(p);
+}
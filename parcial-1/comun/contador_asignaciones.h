@@ -0,0 +1,54 @@
+#ifndef CONTADOR_ASIGNACIONES_H
+#define CONTADOR_ASIGNACIONES_H
+
+#include <cstddef>
+
+/**
+ * Asignaciones de memoria dinámica acumuladas desde el inicio del programa.
+ *
+ * POR QUÉ: El tiempo y el RSS no muestran cuántas copias (strings, vectores) hace un análisis.
+ * CÓMO: contador_asignaciones.cpp reemplaza el operator new global y cuenta cada llamada
+ *       en contadores del hilo, que se suman a los globales cuando el hilo termina.
+ * PARA QUÉ: Medir asignaciones por análisis como diferencia entre dos lecturas.
+ */
+struct ConteoAsignaciones {
+    size_t asignaciones = 0;  // Llamadas a operator new
+    size_t bytes = 0;         // Bytes solicitados
+    size_t liberaciones = 0;  // Llamadas a operator delete (solo con el seguimiento activo)
+};
+
+// Lectura actual de los contadores. Incluye los hilos que ya terminaron y el actual,
+// así que debe hacerse sin trabajo paralelo en curso (entre operaciones).
+ConteoAsignaciones leerAsignaciones();
+
+// Asignaciones ocurridas entre dos lecturas
+inline ConteoAsignaciones operator-(const ConteoAsignaciones& fin, const ConteoAsignaciones& inicio) {
+    ConteoAsignaciones delta;
+    delta.asignaciones = fin.asignaciones - inicio.asignaciones;
+    delta.bytes = fin.bytes - inicio.bytes;
+    delta.liberaciones = fin.liberaciones - inicio.liberaciones;
+    return delta;
+}
+
+/**
+ * Activa el seguimiento de memoria viva (opcional, --asignaciones).
+ *
+ * POR QUÉ: Una diferencia de RSS no ve la memoria que el asignador reutiliza ni los
+ *          temporales que una operación libera antes de terminar.
+ * CÓMO: Desde ese momento, cada new suma y cada delete resta el tamaño real del bloque
+ *       (malloc_usable_size) en un contador atómico global, que lleva su máximo.
+ *       Es opcional porque es la única parte con atomics compartidos entre hilos.
+ * PARA QUÉ: Conocer el pico de memoria dinámica de cada operación.
+ */
+void activarSeguimientoAsignaciones();
+bool seguimientoAsignacionesActivo();
+
+// Bytes vivos (asignados y no liberados) contados desde que se activó el seguimiento;
+// puede ser negativo si se liberan bloques asignados antes
+long long bytesVivos();
+
+// Máximo de bytesVivos() desde la última llamada a reiniciarPicoBytesVivos()
+long long picoBytesVivos();
+void reiniciarPicoBytesVivos();
+
+#endif // CONTADOR_ASIGNACIONES_H
@@ -0,0 +1,114 @@
+#include "contadores_hardware.h"
+#include <cerrno>
+#include <cstring>  // memset, strerror
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char* nombreEventoHardware(EventoHardware evento) {
+    switch (evento) {
+        case EventoHardware::Ciclos: return "Ciclos";
+        case EventoHardware::Instrucciones: return "Instrucciones";
+        case EventoHardware::FallosL1: return "FallosL1";
+        case EventoHardware::FallosLLC: return "FallosLLC";
+        case EventoHardware::FallosSalto: return "FallosSalto";
+        case EventoHardware::FallosPagina: return "FallosPagina";
+    }
+    return "";
+}
+
+LecturaContadores operator-(const LecturaContadores& fin, const LecturaContadores& inicio) {
+    LecturaContadores delta;
+    for (size_t e = 0; e < NUM_EVENTOS_HARDWARE; ++e) {
+        delta.validos[e] = fin.validos[e] && inicio.validos[e];
+        delta.valores[e] = (delta.validos[e] && fin.valores[e] > inicio.valores[e]) ? fin.valores[e] - inicio.valores[e] : 0;
+    }
+    return delta;
+}
+
+#ifdef __linux__
+
+// Tipo y configuración de perf_event_attr de cada evento (en el orden de EventoHardware)
+static const struct {
+    uint32_t tipo;
+    uint64_t configuracion;
+} EVENTOS[NUM_EVENTOS_HARDWARE] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},  // Último nivel de caché
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+};
+
+bool ContadoresHardware::abrir(std::string& error) {
+    cerrar();
+    error.clear();
+    for (size_t e = 0; e < NUM_EVENTOS_HARDWARE; ++e) {
+        perf_event_attr atributos;
+        memset(&atributos, 0, sizeof(atributos));
+        atributos.size = sizeof(atributos);
+        atributos.type = EVENTOS[e].tipo;
+        atributos.config = EVENTOS[e].configuracion;
+        atributos.exclude_kernel = 1;
+        atributos.exclude_hv = 1;
+        atributos.inherit = 1;  // También los hilos creados después
+        atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        long descriptor = syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0);
+        if (descriptor < 0) {
+            if (!error.empty()) error += ", ";
+            error += std::string(nombreEventoHardware(static_cast<EventoHardware>(e))) + " (" + strerror(errno) + ")";
+            continue;
+        }
+        descriptores[e] = static_cast<int>(descriptor);
+    }
+    return abiertos();
+}
+
+void ContadoresHardware::cerrar() {
+    for (int& descriptor : descriptores) {
+        if (descriptor >= 0) close(descriptor);
+        descriptor = -1;
+    }
+}
+
+LecturaContadores ContadoresHardware::leer() const {
+    LecturaContadores lectura;
+    for (size_t e = 0; e < NUM_EVENTOS_HARDWARE; ++e) {
+        if (descriptores[e] < 0) continue;
+        uint64_t datos[3];  // Valor, tiempo habilitado, tiempo en ejecución
+        if (read(descriptores[e], datos, sizeof(datos)) != static_cast<ssize_t>(sizeof(datos))) continue;
+        double valor = static_cast<double>(datos[0]);
+        if (datos[2] > 0 && datos[2] < datos[1]) valor *= static_cast<double>(datos[1]) / static_cast<double>(datos[2]);
+        lectura.valores[e] = static_cast<uint64_t>(valor);
+        lectura.validos[e] = true;
+    }
+    return lectura;
+}
+
+#else
+
+bool ContadoresHardware::abrir(std::string& error) {
+    error = "perf_event_open solo existe en Linux";
+    return false;
+}
+
+void ContadoresHardware::cerrar() {}
+
+LecturaContadores ContadoresHardware::leer() const {
+    return LecturaContadores();
+}
+
+#endif
+
+bool ContadoresHardware::abiertos() const {
+    for (int descriptor : descriptores) {
+        if (descriptor >= 0) return true;
+    }
+    return false;
+}
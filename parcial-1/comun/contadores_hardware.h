@@ -0,0 +1,72 @@
+#ifndef CONTADORES_HARDWARE_H
+#define CONTADORES_HARDWARE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// --- Contadores de hardware del procesador (perf_event_open, Linux) ---
+
+// Eventos que se leen, en este orden
+enum class EventoHardware { Ciclos, Instrucciones, FallosL1, FallosLLC, FallosSalto, FallosPagina };
+
+const size_t NUM_EVENTOS_HARDWARE = 6;
+
+// Nombre corto del evento (para tablas y encabezados CSV)
+const char* nombreEventoHardware(EventoHardware evento);
+
+/**
+ * Valores de los contadores en un momento, o la diferencia entre dos momentos.
+ */
+struct LecturaContadores {
+    std::array<uint64_t, NUM_EVENTOS_HARDWARE> valores{};
+    std::array<bool, NUM_EVENTOS_HARDWARE> validos{};  // false: el evento no se pudo abrir
+
+    bool valido(EventoHardware evento) const { return validos[static_cast<size_t>(evento)]; }
+    uint64_t valor(EventoHardware evento) const { return valores[static_cast<size_t>(evento)]; }
+};
+
+// Eventos ocurridos entre dos lecturas (válido si lo es en ambas)
+LecturaContadores operator-(const LecturaContadores& fin, const LecturaContadores& inicio);
+
+/**
+ * Contadores de hardware del proceso.
+ *
+ * POR QUÉ: El tiempo no explica por qué estructuras y clases, o valor y referencia,
+ *          difieren 2-4x en los mismos análisis; los ciclos, instrucciones y fallos de
+ *          caché y de predicción de saltos sí.
+ * CÓMO: Un descriptor de perf_event_open por evento, solo espacio de usuario
+ *       (exclude_kernel, permitido con perf_event_paranoid <= 2) y con 'inherit' para
+ *       contar también los hilos que se creen después. Si el kernel multiplexa los
+ *       contadores, cada valor se escala por tiempo habilitado / tiempo en ejecución.
+ *       Un evento que no se puede abrir (sin permiso, máquina virtual sin PMU) se marca
+ *       como no válido y los demás siguen funcionando.
+ * PARA QUÉ: Medir IPC y fallos por registro de cada operación del Monitor.
+ */
+class ContadoresHardware {
+public:
+    ContadoresHardware() { descriptores.fill(-1); }
+    ~ContadoresHardware() { cerrar(); }
+
+    ContadoresHardware(const ContadoresHardware&) = delete;
+    ContadoresHardware& operator=(const ContadoresHardware&) = delete;
+
+    /**
+     * Abre los eventos disponibles.
+     * @param error Si falta algún evento, los que faltan y el motivo.
+     * @return false si no se pudo abrir ninguno.
+     */
+    bool abrir(std::string& error);
+    void cerrar();
+
+    bool abiertos() const;
+
+    // Valores acumulados desde abrir() (todos no válidos si no hay contadores abiertos)
+    LecturaContadores leer() const;
+
+private:
+    std::array<int, NUM_EVENTOS_HARDWARE> descriptores;
+};
+
+#endif // CONTADORES_HARDWARE_H
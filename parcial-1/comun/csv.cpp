@@ -0,0 +1,443 @@
+#include "csv.h"
+#include "archivo_mapeado.h"
+#include "fecha.h"
+#include "paralelo.h" // paraCadaBloque
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+const char* const CABECERA_CSV =
+    "id,nombre,apellido,fecha_nacimiento,ciudad_nacimiento,ingresos_anuales,patrimonio,deudas,declarante_renta\n";
+
+// Bytes aproximados por trozo (el corte real se corre hasta el siguiente salto de línea)
+static const size_t BYTES_TROZO = 4 << 20;
+
+// Años de nacimiento aceptados: la edad debe caber en Persona::edad (uint8_t)
+
+// --- Escritura ---
+
+static void escribirTexto(BufferSalida& salida, const TextoCsv& texto) {
+    bool comillas = std::memchr(texto.datos, ',', texto.largo) || std::memchr(texto.datos, '"', texto.largo);
+    if (!comillas) {
+        salida.agregar(texto.datos, texto.largo);
+        return;
+    }
+    salida.agregar('"');
+    for (size_t i = 0; i < texto.largo; ++i) {
+        if (texto.datos[i] == '"') salida.agregar('"');
+        salida.agregar(texto.datos[i]);
+    }
+    salida.agregar('"');
+}
+
+// Entero de 2 cifras con cero a la izquierda (mes y día)
+static void escribirDosCifras(BufferSalida& salida, int valor) {
+    salida.agregar(static_cast<char>('0' + valor / 10 % 10));
+    salida.agregar(static_cast<char>('0' + valor % 10));
+}
+
+void escribirRegistroCsv(BufferSalida& salida, const RegistroCsv& registro) {
+    salida.agregarEntero(registro.id);
+    salida.agregar(',');
+    escribirTexto(salida, registro.nombre);
+    salida.agregar(',');
+    escribirTexto(salida, registro.apellido);
+    salida.agregar(',');
+    salida.agregarEntero(static_cast<uint64_t>(anioDeFecha(registro.fecha)));
+    salida.agregar('-');
+    escribirDosCifras(salida, mesDeFecha(registro.fecha));
+    salida.agregar('-');
+    escribirDosCifras(salida, diaDeFecha(registro.fecha));
+    salida.agregar(',');
+    salida.agregar(nombreCiudad(registro.ciudad));
+    salida.agregar(',');
+    salida.agregarDecimal2(registro.ingresos);
+    salida.agregar(',');
+    salida.agregarDecimal2(registro.patrimonio);
+    salida.agregar(',');
+    salida.agregarDecimal2(registro.deudas);
+    salida.agregar(',');
+    salida.agregar(registro.declarante ? '1' : '0');
+    salida.agregar('\n');
+}
+
+// --- Análisis de campos ---
+
+// Primera ',' en [p, fin) o 'fin'; compara 16 bytes por instrucción cuando hay SSE2
+static inline const char* buscarComa(const char* p, const char* fin) {
+#if defined(__SSE2__)
+    const __m128i coma = _mm_set1_epi8(',');
+    while (fin - p >= 16) {
+        __m128i bloque = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        unsigned mascara = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bloque, coma)));
+        if (mascara != 0) return p + __builtin_ctz(mascara);
+        p += 16;
+    }
+#endif
+    while (p < fin && *p != ',') ++p;
+    return p;
+}
+
+// Separa el siguiente campo sin comillas; el último debe terminar en el fin de la línea
+static const char* campoSimple(const char*& p, const char* fin, bool ultimo, TextoCsv& campo) {
+    const char* coma = buscarComa(p, fin);
+    if (!ultimo && coma == fin) return "faltan columnas";
+    if (ultimo && coma != fin) return "sobran columnas";
+    campo.datos = p;
+    campo.largo = static_cast<size_t>(coma - p);
+    p = ultimo ? fin : coma + 1;
+    return nullptr;
+}
+
+// Campo de texto, con o sin comillas; si tenía "" escapadas se arma en 'auxiliar'
+static const char* campoTexto(const char*& p, const char* fin, TextoCsv& campo, std::string& auxiliar) {
+    if (p == fin || *p != '"') return campoSimple(p, fin, false, campo);
+
+    const char* inicio = ++p;
+    bool escapadas = false;
+    for (;;) {
+        const char* comilla = static_cast<const char*>(std::memchr(p, '"', static_cast<size_t>(fin - p)));
+        if (!comilla) return "comillas sin cerrar";
+        if (comilla + 1 < fin && comilla[1] == '"') {
+            escapadas = true;
+            p = comilla + 2;
+            continue;
+        }
+        p = comilla + 1;
+        break;
+    }
+    const char* cierre = p - 1;
+    if (p == fin || *p != ',') return (p == fin) ? "faltan columnas" : "texto después de las comillas";
+    ++p;
+
+    if (!escapadas) {
+        campo.datos = inicio;
+        campo.largo = static_cast<size_t>(cierre - inicio);
+        return nullptr;
+    }
+    auxiliar.clear();
+    for (const char* c = inicio; c < cierre; ++c) {
+        auxiliar.push_back(*c);
+        if (*c == '"') ++c; // La segunda comilla del par
+    }
+    campo.datos = auxiliar.data();
+    campo.largo = auxiliar.size();
+    return nullptr;
+}
+
+static bool parsearEntero(const TextoCsv& campo, uint64_t& valor) {
+    if (campo.largo == 0 || campo.largo > 20) return false;
+    uint64_t v = 0;
+    for (size_t i = 0; i < campo.largo; ++i) {
+        unsigned d = static_cast<unsigned>(static_cast<unsigned char>(campo.datos[i]) - '0');
+        if (d > 9 || v > (UINT64_MAX - d) / 10) return false;
+        v = v * 10 + d;
+    }
+    valor = v;
+    return true;
+}
+
+// Potencias de 10 exactas en double
+static const double POTENCIAS_10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * Convierte un decimal ("-123.45") a double.
+ *
+ * CÓMO: Con hasta 15 cifras la mantisa entera y la potencia de 10 son exactas en double y una
+ *       sola división da el valor correctamente redondeado (igual que strtod); los demás casos
+ *       (exponentes, más cifras) se copian a un buffer terminado en '\0' para strtod.
+ */
+static bool parsearMonto(const TextoCsv& campo, double& valor) {
+    const char* p = campo.datos;
+    const char* fin = p + campo.largo;
+    bool negativo = false;
+    if (p < fin && (*p == '-' || *p == '+')) negativo = (*p++ == '-');
+
+    // Parte entera y fracción en dos ciclos (sin preguntar por el punto en cada cifra)
+    uint64_t mantisa = 0;
+    const char* inicioEntera = p;
+    while (p < fin && static_cast<unsigned>(*p - '0') <= 9) mantisa = mantisa * 10 + static_cast<unsigned>(*p++ - '0');
+    int cifras = static_cast<int>(p - inicioEntera);
+    int decimales = 0;
+    if (p < fin && *p == '.') {
+        const char* inicioFraccion = ++p;
+        while (p < fin && static_cast<unsigned>(*p - '0') <= 9) mantisa = mantisa * 10 + static_cast<unsigned>(*p++ - '0');
+        decimales = static_cast<int>(p - inicioFraccion);
+        cifras += decimales;
+    }
+    if (p == fin && cifras > 0 && cifras <= 15) {
+        double v = static_cast<double>(mantisa) / POTENCIAS_10[decimales];
+        valor = negativo ? -v : v;
+        return true;
+    }
+
+    char copia[64];
+    if (campo.largo == 0 || campo.largo >= sizeof(copia)) return false;
+    std::memcpy(copia, campo.datos, campo.largo);
+    copia[campo.largo] = '\0';
+    char* finConversion = nullptr;
+    valor = std::strtod(copia, &finConversion);
+    return finConversion == copia + campo.largo && std::isfinite(valor);
+}
+
+// Número de 1 a 4 cifras que termina en 'separador' (o en el fin del campo si separador = 0)
+static bool parsearParteFecha(const char*& p, const char* fin, char separador, int& valor) {
+    int v = 0;
+    int cifras = 0;
+    while (p < fin && *p >= '0' && *p <= '9' && cifras < 4) {
+        v = v * 10 + (*p++ - '0');
+        ++cifras;
+    }
+    if (cifras == 0) return false;
+    if (separador != 0) {
+        if (p == fin || *p != separador) return false;
+        ++p;
+    } else if (p != fin) {
+        return false;
+    }
+    valor = v;
+    return true;
+}
+
+// AAAA-MM-DD o D/M/AAAA
+static bool parsearFecha(const TextoCsv& campo, uint32_t& fecha) {
+    const char* p = campo.datos;
+    const char* fin = p + campo.largo;
+    int dia, mes, anio;
+    bool iso = campo.largo > 4 && p[4] == '-'; // El año ISO siempre tiene 4 cifras
+    bool correcta = iso
+        ? parsearParteFecha(p, fin, '-', anio) && parsearParteFecha(p, fin, '-', mes) && parsearParteFecha(p, fin, 0, dia)
+        : parsearParteFecha(p, fin, '/', dia) && parsearParteFecha(p, fin, '/', mes) && parsearParteFecha(p, fin, 0, anio);
+    if (!correcta || mes < 1 || mes > 12 || dia < 1 || dia > diasDelMes(mes, anio) ||
+        anio > ANIO_ACTUAL || anio < ANIO_ACTUAL - EDAD_MAXIMA_ARCHIVO) {
+        return false;
+    }
+    fecha = empaquetarFecha(dia, mes, anio);
+    return true;
+}
+
+// Búsqueda del nombre sin construir un std::string (solo hay NUM_CIUDADES candidatas)
+static bool parsearCiudad(const TextoCsv& campo, CiudadId& ciudad) {
+    for (size_t c = 0; c < NUM_CIUDADES; ++c) {
+        const std::string& nombre = ciudadesColombia[c];
+        if (nombre.size() == campo.largo && std::memcmp(nombre.data(), campo.datos, campo.largo) == 0) {
+            ciudad = static_cast<CiudadId>(c);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Analiza una línea sin su salto de línea.
+ *
+ * @return nullptr si la fila es válida, o el motivo del error.
+ */
+static const char* analizarFila(const char* p, const char* fin, RegistroCsv& registro,
+                                std::string& auxNombre, std::string& auxApellido) {
+    TextoCsv campo;
+    const char* error;
+
+    if ((error = campoSimple(p, fin, false, campo))) return error;
+    if (!parsearEntero(campo, registro.id)) return "id inválido";
+    if ((error = campoTexto(p, fin, registro.nombre, auxNombre))) return error;
+    if ((error = campoTexto(p, fin, registro.apellido, auxApellido))) return error;
+    if ((error = campoSimple(p, fin, false, campo))) return error;
+    if (!parsearFecha(campo, registro.fecha)) return "fecha de nacimiento inválida";
+    if ((error = campoSimple(p, fin, false, campo))) return error;
+    if (!parsearCiudad(campo, registro.ciudad)) return "ciudad desconocida";
+    if ((error = campoSimple(p, fin, false, campo))) return error;
+    if (!parsearMonto(campo, registro.ingresos)) return "ingresos inválidos";
+    if ((error = campoSimple(p, fin, false, campo))) return error;
+    if (!parsearMonto(campo, registro.patrimonio)) return "patrimonio inválido";
+    if ((error = campoSimple(p, fin, false, campo))) return error;
+    if (!parsearMonto(campo, registro.deudas)) return "deudas inválidas";
+    if ((error = campoSimple(p, fin, true, campo))) return error;
+    if (campo.largo != 1 || (campo.datos[0] != '0' && campo.datos[0] != '1')) return "declarante debe ser 0 o 1";
+    registro.declarante = campo.datos[0] == '1';
+    return nullptr;
+}
+
+bool analizarRegistroCsv(const std::string& linea, RegistroCsv& registro,
+                         std::string& auxNombre, std::string& auxApellido, std::string& error) {
+    const char* motivo = analizarFila(linea.data(), linea.data() + linea.size(), registro, auxNombre, auxApellido);
+    if (motivo) error = motivo;
+    return motivo == nullptr;
+}
+
+// Fin de la línea que empieza en 'p' (sin '\r') y comienzo de la siguiente
+static inline const char* finDeLinea(const char* p, const char* fin, const char*& siguiente) {
+    const char* salto = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(fin - p)));
+    siguiente = salto ? salto + 1 : fin;
+    const char* finLinea = salto ? salto : fin;
+    if (finLinea > p && finLinea[-1] == '\r') --finLinea;
+    return finLinea;
+}
+
+// --- Lector ---
+
+size_t LectorCsv::tamArchivo() const { return archivo->tam(); }
+
+std::unique_ptr<LectorCsv> LectorCsv::abrir(const std::string& ruta, std::string& error) {
+    std::shared_ptr<ArchivoMapeado> mapeo = ArchivoMapeado::abrir(ruta, error);
+    if (!mapeo) return nullptr;
+    mapeo->lecturaSecuencial();
+    const char* datos = mapeo->datos();
+    size_t n = mapeo->tam();
+
+    // Cabecera opcional: si la primera línea no empieza con una cifra debe ser la esperada
+    size_t inicio = 0;
+    size_t primeraLinea = 1;
+    if (n > 0 && !(datos[0] >= '0' && datos[0] <= '9')) {
+        const char* siguiente;
+        const char* finLinea = finDeLinea(datos, datos + n, siguiente);
+        size_t largoEsperado = std::strlen(CABECERA_CSV) - 1; // Sin el '\n'
+        if (static_cast<size_t>(finLinea - datos) != largoEsperado ||
+            std::memcmp(datos, CABECERA_CSV, largoEsperado) != 0) {
+            error = "línea 1: cabecera desconocida (se espera " + std::string(CABECERA_CSV, largoEsperado) + ")";
+            return nullptr;
+        }
+        inicio = static_cast<size_t>(siguiente - datos);
+        primeraLinea = 2;
+    }
+
+    std::unique_ptr<LectorCsv> lector(new LectorCsv());
+    lector->archivo = std::move(mapeo);
+
+    // Trozos de ~BYTES_TROZO que terminan justo después de un salto de línea
+    while (inicio < n) {
+        size_t fin = std::min(n, inicio + BYTES_TROZO);
+        if (fin < n) {
+            const void* salto = std::memchr(datos + fin - 1, '\n', n - fin + 1);
+            fin = salto ? static_cast<size_t>(static_cast<const char*>(salto) - datos) + 1 : n;
+        }
+        Trozo trozo;
+        trozo.inicio = inicio;
+        trozo.fin = fin;
+        lector->trozos.push_back(trozo);
+        inicio = fin;
+    }
+
+    // Filas (líneas no vacías) y líneas de cada trozo, en paralelo
+    std::vector<Trozo>& trozos = lector->trozos;
+    paraCadaBloque(trozos.size(), 1, 0, [&](size_t, size_t desde, size_t hasta) {
+        for (size_t t = desde; t < hasta; ++t) {
+            const char* p = datos + trozos[t].inicio;
+            const char* fin = datos + trozos[t].fin;
+            while (p < fin) {
+                const char* siguiente;
+                const char* finLinea = finDeLinea(p, fin, siguiente);
+                ++trozos[t].lineas;
+                if (finLinea != p) ++trozos[t].filas;
+                p = siguiente;
+            }
+            // El conteo no retiene el archivo en memoria (importa en el modo por lotes)
+            lector->archivo->liberar(trozos[t].inicio, trozos[t].fin);
+        }
+    });
+
+    size_t fila = 0;
+    size_t linea = primeraLinea;
+    for (Trozo& trozo : trozos) {
+        trozo.primeraFila = fila;
+        trozo.primeraLinea = linea;
+        fila += trozo.filas;
+        linea += trozo.lineas;
+    }
+    lector->totalFilas = fila;
+    return lector;
+}
+
+bool LectorCsv::recorrer(const std::function<void(size_t, const RegistroCsv&)>& guardar,
+                         std::string& error) const {
+    return recorrer(0, totalFilas, guardar, error);
+}
+
+bool LectorCsv::recorrer(size_t desdeFila, size_t hastaFila,
+                         const std::function<void(size_t, const RegistroCsv&)>& guardar,
+                         std::string& error) const {
+    const char* datos = archivo->datos();
+
+    // Trozos con filas del rango [desdeFila, hastaFila)
+    size_t primero = 0;
+    while (primero < trozos.size() && trozos[primero].primeraFila + trozos[primero].filas <= desdeFila) ++primero;
+    size_t ultimo = primero;
+    while (ultimo < trozos.size() && trozos[ultimo].primeraFila < hastaFila) ++ultimo;
+    size_t cantidad = ultimo - primero;
+
+    // Primer trozo con error: los posteriores ya no se analizan (el informe sigue siendo
+    // el del primer error del rango porque los trozos se toman en orden)
+    std::atomic<size_t> trozoConError(cantidad);
+    std::vector<std::string> errores(cantidad);
+
+    paraCadaBloque(cantidad, 1, 0, [&](size_t, size_t desde, size_t hasta) {
+        RegistroCsv registro;
+        std::string auxNombre, auxApellido;
+        for (size_t k = desde; k < hasta; ++k) {
+            if (k > trozoConError.load(std::memory_order_relaxed)) return;
+            const Trozo& trozo = trozos[primero + k];
+            const char* p = datos + trozo.inicio;
+            const char* fin = datos + trozo.fin;
+            size_t fila = trozo.primeraFila;
+            size_t linea = trozo.primeraLinea;
+            for (; p < fin && fila < hastaFila; ++linea) {
+                const char* siguiente;
+                const char* finLinea = finDeLinea(p, fin, siguiente);
+                if (finLinea != p) {
+                    if (fila >= desdeFila) {
+                        const char* motivo = analizarFila(p, finLinea, registro, auxNombre, auxApellido);
+                        if (motivo) {
+                            errores[k] = "línea " + std::to_string(linea) + ": " + motivo;
+                            size_t actual = trozoConError.load();
+                            while (k < actual && !trozoConError.compare_exchange_weak(actual, k)) {}
+                            return;
+                        }
+                        guardar(fila, registro);
+                    }
+                    ++fila;
+                }
+                p = siguiente;
+            }
+        }
+    });
+
+    if (trozoConError.load() < cantidad) {
+        error = errores[trozoConError.load()];
+        return false;
+    }
+    return true;
+}
+
+void LectorCsv::liberarHasta(size_t fila) const {
+    size_t hasta = 0;
+    for (const Trozo& trozo : trozos) {
+        if (trozo.primeraFila + trozo.filas > fila) break;
+        hasta = trozo.fin;
+    }
+    archivo->liberar(0, hasta);
+}
+
+size_t LectorCsv::lineaDeFila(size_t fila) const {
+    const char* datos = archivo->datos();
+    for (const Trozo& trozo : trozos) {
+        if (fila >= trozo.primeraFila + trozo.filas) continue;
+        const char* p = datos + trozo.inicio;
+        const char* fin = datos + trozo.fin;
+        size_t actual = trozo.primeraFila;
+        for (size_t linea = trozo.primeraLinea; p < fin; ++linea) {
+            const char* siguiente;
+            const char* finLinea = finDeLinea(p, fin, siguiente);
+            if (finLinea != p && actual++ == fila) return linea;
+            p = siguiente;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+#ifndef CSV_H
+#define CSV_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "buffer_salida.h"
+#include "ciudades.h"
+#include "texto.h"
+
+/**
+ * Importación y exportación de personas en CSV.
+ *
+ * POR QUÉ: La única forma de tener datos era generarlos; no se podían cargar extractos reales
+ *          de decenas de millones de filas ni sacar el conjunto a otras herramientas.
+ * CÓMO: El archivo se mapea con mmap y se parte en trozos que terminan en un salto de línea;
+ *       cada hilo analiza sus trozos sin copiar el texto (los campos son punteros al mapeo),
+ *       con búsqueda vectorizada (SSE2) de separadores y números convertidos a mano.
+ * PARA QUÉ: Leer cientos de MB/s desde la caché de páginas y escribir con BufferSalida.
+ *
+ * Formato (una persona por línea, separador ',', primera línea opcional con los nombres):
+ *   id,nombre,apellido,fecha_nacimiento,ciudad_nacimiento,ingresos_anuales,patrimonio,deudas,declarante_renta
+ *   - fecha: AAAA-MM-DD (también se acepta D/M/AAAA, como la muestra el programa)
+ *   - ciudad: nombre exacto de ciudadesColombia
+ *   - montos: decimales con punto; se exportan con 2 cifras (centavos)
+ *   - declarante: 1 o 0
+ *   Los textos pueden ir entre comillas dobles ("" dentro es una comilla); ningún campo
+ *   puede contener saltos de línea. El grupo DIAN, el año y la edad se derivan al importar.
+ */
+
+// Primera línea del archivo exportado
+extern const char* const CABECERA_CSV;
+
+// Texto dentro del archivo mapeado (o en un buffer auxiliar si tenía comillas escapadas)
+using TextoCsv = Texto;
+
+// Campos de una fila
+struct RegistroCsv {
+    uint64_t id = 0;
+    TextoCsv nombre;
+    TextoCsv apellido;
+    uint32_t fecha = 0;          // AAAAMMDD
+    CiudadId ciudad = 0;
+    double ingresos = 0;
+    double patrimonio = 0;
+    double deudas = 0;
+    bool declarante = false;
+};
+
+/**
+ * Escribe una fila en el buffer (con su salto de línea).
+ *
+ * CÓMO: Enteros y montos con el formateo propio de BufferSalida; los textos solo se
+ *       ponen entre comillas si contienen ',' o '"'.
+ */
+void escribirRegistroCsv(BufferSalida& salida, const RegistroCsv& registro);
+
+/**
+ * Analiza una sola fila (sin salto de línea) con las mismas reglas que LectorCsv.
+ *
+ * PARA QUÉ: Altas y cambios de personas desde el menú con el formato de importación.
+ * @return false (con el motivo en 'error') si la fila no es válida. Los textos del registro
+ *         apuntan a 'linea' o a los auxiliares, que deben seguir vivos mientras se usen.
+ */
+bool analizarRegistroCsv(const std::string& linea, RegistroCsv& registro,
+                         std::string& auxNombre, std::string& auxApellido, std::string& error);
+
+// Archivo mapeado en memoria (archivo_mapeado.h)
+class ArchivoMapeado;
+
+/**
+ * Lector de un archivo CSV de personas.
+ *
+ * POR QUÉ: Para llenar un vector ya dimensionado desde varios hilos hay que saber
+ *          cuántas filas hay y en qué fila empieza cada trozo.
+ * CÓMO: abrir() mapea el archivo, lo parte en trozos de ~4 MiB cortados en saltos de línea
+ *       y cuenta las filas de cada trozo en paralelo (memchr); recorrer() analiza los trozos
+ *       en paralelo y entrega cada fila con su posición final.
+ * PARA QUÉ: Que cada variante construya sus Persona sin conocer el formato.
+ */
+class LectorCsv {
+public:
+    // Mapea y cuenta las filas de 'ruta'; nullptr (con el motivo en 'error') si no se pudo
+    static std::unique_ptr<LectorCsv> abrir(const std::string& ruta, std::string& error);
+
+    size_t filas() const { return totalFilas; }
+    size_t tamArchivo() const;
+
+    /**
+     * Analiza todas las filas y llama guardar(fila, registro) una vez por cada una.
+     *
+     * CÓMO: Los trozos se reparten entre hilos (paraCadaBloque); 'guardar' se llama en
+     *       paralelo, siempre con filas distintas. Los textos del registro solo son válidos
+     *       durante la llamada.
+     * @return false con "línea N: motivo" en 'error' (el primer error del archivo).
+     */
+    bool recorrer(const std::function<void(size_t, const RegistroCsv&)>& guardar,
+                  std::string& error) const;
+
+    /**
+     * Igual que recorrer, pero solo para las filas [desdeFila, hastaFila).
+     *
+     * POR QUÉ: El modo por lotes lee el archivo por partes de tamaño fijo.
+     * CÓMO: Solo se analizan los trozos que tienen filas del rango; las filas anteriores
+     *       de un trozo se saltan sin convertir sus campos.
+     */
+    bool recorrer(size_t desdeFila, size_t hastaFila,
+                  const std::function<void(size_t, const RegistroCsv&)>& guardar,
+                  std::string& error) const;
+
+    // Devuelve al sistema las páginas de los trozos cuyas filas son todas anteriores a 'fila'
+    void liberarHasta(size_t fila) const;
+
+    // Línea del archivo (base 1) de 'fila', para informar errores que no son de formato
+    size_t lineaDeFila(size_t fila) const;
+
+private:
+    LectorCsv() = default;
+
+    // Porción del archivo que termina justo después de un salto de línea (o en el final)
+    struct Trozo {
+        size_t inicio = 0;
+        size_t fin = 0;
+        size_t primeraFila = 0;   // Fila (sin contar la cabecera) de su primer registro
+        size_t primeraLinea = 0;  // Línea del archivo (base 1) de su primer byte
+        size_t filas = 0;
+        size_t lineas = 0;
+    };
+
+    std::shared_ptr<ArchivoMapeado> archivo;
+    std::vector<Trozo> trozos;
+    size_t totalFilas = 0;
+};
+
+#endif // CSV_H
@@ -0,0 +1,6 @@
+#include "fecha.h"
+
+std::string formatearFecha(uint32_t fecha) {
+    return std::to_string(diaDeFecha(fecha)) + "/" + std::to_string(mesDeFecha(fecha)) + "/" +
+           std::to_string(anioDeFecha(fecha));
+}
@@ -0,0 +1,48 @@
+#ifndef FECHA_H
+#define FECHA_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Fechas empaquetadas como entero AAAAMMDD.
+ *
+ * POR QUÉ: Guardar la fecha como texto "DD/MM/AAAA" obliga a parsearla (find, substr, stoi)
+ *          cada vez que se necesita la edad.
+ * CÓMO: Un uint32_t con el año en las cifras altas; el orden numérico coincide con el cronológico.
+ * PARA QUÉ: Comparar y extraer el año con aritmética entera y formatear solo al mostrar.
+ */
+
+// Año de referencia para el cálculo de edades
+const int ANIO_ACTUAL = 2025;
+
+// Edad máxima admitida en fechas que vienen de archivos (importar CSV, cargar snapshot)
+const int EDAD_MAXIMA_ARCHIVO = 150;
+
+inline uint32_t empaquetarFecha(int dia, int mes, int anio) {
+    return static_cast<uint32_t>(anio * 10000 + mes * 100 + dia);
+}
+
+inline int anioDeFecha(uint32_t fecha) { return static_cast<int>(fecha / 10000); }
+inline int mesDeFecha(uint32_t fecha) { return static_cast<int>(fecha / 100 % 100); }
+inline int diaDeFecha(uint32_t fecha) { return static_cast<int>(fecha % 100); }
+
+inline bool esBisiesto(int anio) { return (anio % 4 == 0 && anio % 100 != 0) || anio % 400 == 0; }
+
+// Días del mes 'mes' (1-12) en 'anio'; febrero tiene 29 en los años bisiestos
+inline int diasDelMes(int mes, int anio) {
+    static const int dias[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return (mes == 2 && esBisiesto(anio)) ? 29 : dias[mes - 1];
+}
+
+// Edad aproximada (por año) de alguien nacido en 'anioNacimiento'
+inline int calcularEdad(int anioNacimiento) { return ANIO_ACTUAL - anioNacimiento; }
+
+/**
+ * Formatea una fecha empaquetada como "D/M/AAAA".
+ *
+ * PARA QUÉ: Mostrar la fecha con el mismo formato que generaba la versión de texto.
+ */
+std::string formatearFecha(uint32_t fecha);
+
+#endif // FECHA_H
@@ -0,0 +1,1360 @@
+#include "generador.h"
+#include <ctime>     // time()
+#include "aleatorio.h" // MotorAleatorio, enteroAleatorio, decimalAleatorio
+#include "paralelo.h"  // paraCadaBloque, reducirPorBloques
+#include "perfilador.h" // Fase
+#include "analitica.h" // Analitica, AccesoPersona (opciones 4-8 con objetos, lectura de campos)
+#include "seleccion.h" // mayoresPorGrupo, percentilesPorGrupo, bocetosPorGrupo
+#include <vector>
+#include <algorithm> // std::find_if, std::sort
+#include <array>     // std::array para agrupaciones por ciudad
+#include <iomanip>   // std::fixed, std::setprecision
+#include <unordered_map> // Diccionario de nombres del snapshot
+
+// Cómo se lee y se arma una Persona en esta variante (persona.h): métodos o campos
+using Acceso = AccesoPersona;
+
+// Bases de datos para generación realista
+
+// Nombres femeninos comunes en Colombia
+const std::vector<std::string> nombresFemeninos = {
+    "María", "Luisa", "Carmen", "Ana", "Sofía", "Isabel", "Laura", "Andrea", "Paula", "Valentina",
+    "Camila", "Daniela", "Carolina", "Fernanda", "Gabriela", "Patricia", "Claudia", "Diana", "Lucía", "Ximena"
+};
+
+// Nombres masculinos comunes en Colombia
+const std::vector<std::string> nombresMasculinos = {
+    "Juan", "Carlos", "José", "James", "Andrés", "Miguel", "Luis", "Pedro", "Alejandro", "Ricardo",
+    "Felipe", "David", "Jorge", "Santiago", "Daniel", "Fernando", "Diego", "Rafael", "Martín", "Óscar",
+    "Edison", "Nestor", "Gertridis"
+};
+
+// Apellidos comunes en Colombia
+const std::vector<std::string> apellidos = {
+    "Gómez", "Rodríguez", "Martínez", "López", "García", "Pérez", "González", "Sánchez", "Ramírez", "Torres",
+    "Díaz", "Vargas", "Castro", "Ruiz", "Álvarez", "Romero", "Suárez", "Rojas", "Moreno", "Muñoz", "Valencia",
+};
+
+// Las ciudades viven en el diccionario compartido (ciudades.h)
+
+/**
+ * Textos de la generación (nombres y apellidos compuestos), internados una sola vez.
+ * 
+ * POR QUÉ: Cada persona generada copiaba su nombre y armaba su apellido compuesto en un
+ *          std::string nuevo, aunque solo hay unos cientos de combinaciones posibles.
+ * CÓMO: Una arena con los nombres y todas las combinaciones de dos apellidos, creada en
+ *       el primer uso (static local, seguro entre hilos) y que vive todo el programa.
+ * PARA QUÉ: Generar personas sin asignar memoria por persona.
+ */
+struct CatalogoNombres {
+    ArenaTextos arena;
+    std::vector<Texto> femeninos;
+    std::vector<Texto> masculinos;
+    std::vector<Texto> apellidosCompuestos; // apellidos[a] + " " + apellidos[b] en la posición a * apellidos.size() + b
+
+    CatalogoNombres() {
+        for (const auto& nombre : nombresFemeninos) femeninos.push_back(arena.internar(nombre.data(), nombre.size()));
+        for (const auto& nombre : nombresMasculinos) masculinos.push_back(arena.internar(nombre.data(), nombre.size()));
+        for (const auto& primero : apellidos) {
+            for (const auto& segundo : apellidos) {
+                std::string compuesto = primero + " " + segundo;
+                apellidosCompuestos.push_back(arena.internar(compuesto.data(), compuesto.size()));
+            }
+        }
+    }
+};
+
+static const CatalogoNombres& catalogoNombres() {
+    static const CatalogoNombres catalogo;
+    return catalogo;
+}
+
+/**
+ * Motor de las funciones que no reciben uno explícito.
+ * 
+ * POR QUÉ: Conservar la API sin motor (generarPersona(), randomDouble()).
+ * CÓMO: Un MotorAleatorio estático sembrado con la hora hasta que se llame a sembrarGenerador.
+ * PARA QUÉ: Uso desde el hilo principal; la generación paralela usa motores propios.
+ */
+static MotorAleatorio& motorCompartido() {
+    static MotorAleatorio motor(static_cast<uint64_t>(time(nullptr)));
+    return motor;
+}
+
+void sembrarGenerador(uint64_t semilla) {
+    motorCompartido().seed(semilla);
+}
+
+/**
+ * Implementación de generarFechaNacimiento.
+ * 
+ * POR QUÉ: Simular fechas de nacimiento realistas.
+ * CÓMO: Día (1-28), mes (1-12), año (1960-2009), tomados del motor recibido.
+ * PARA QUÉ: Atributo fechaNacimiento de Persona.
+ */
+template <typename Motor>
+uint32_t generarFechaNacimiento(Motor& motor) {
+    int dia = 1 + enteroAleatorio(motor, 28);     // Día: 1 a 28 (evita problemas con meses)
+    int mes = 1 + enteroAleatorio(motor, 12);     // Mes: 1 a 12
+    int anio = 1960 + enteroAleatorio(motor, 50); // Año: 1960 a 2009
+    return empaquetarFecha(dia, mes, anio);
+}
+
+uint32_t generarFechaNacimiento() {
+    return generarFechaNacimiento(motorCompartido());
+}
+
+// Próximo ID a entregar (compartido por generarID y reservarIDs)
+static uint64_t contadorID = PRIMER_ID;
+
+/**
+ * Implementación de generarID.
+ * 
+ * POR QUÉ: Generar identificadores únicos y secuenciales.
+ * CÓMO: Contador que inicia en PRIMER_ID y se incrementa.
+ * PARA QUÉ: Simular números de cédula (como entero; se formatea solo al mostrar).
+ */
+uint64_t generarID() {
+    return contadorID++;
+}
+
+/**
+ * Implementación de reservarIDs.
+ * 
+ * POR QUÉ: Los hilos de generarColeccion(n) no pueden compartir el contador.
+ * CÓMO: Avanzando el contador 'cantidad' posiciones de una vez.
+ * PARA QUÉ: Que la persona i reciba el ID primero + i sin sincronización.
+ */
+uint64_t reservarIDs(size_t cantidad) {
+    uint64_t primero = contadorID;
+    contadorID += cantidad;
+    return primero;
+}
+
+/**
+ * Implementación de randomDouble.
+ * 
+ * POR QUÉ: Generar números decimales aleatorios en un rango.
+ * CÓMO: decimalAleatorio sobre el motor compartido.
+ * PARA QUÉ: Valores de ingresos, patrimonio, etc.
+ */
+double randomDouble(double min, double max) {
+    return decimalAleatorio(motorCompartido(), min, max);
+}
+
+/**
+ * Implementación de generarPersona.
+ * 
+ * POR QUÉ: Crear una persona con datos aleatorios.
+ * CÓMO: Tomando todos los valores aleatorios del motor recibido, en un orden fijo.
+ * PARA QUÉ: Que la misma secuencia del motor produzca siempre la misma persona.
+ */
+template <typename Motor>
+Persona generarPersona(Motor& motor, uint64_t id) {
+    const CatalogoNombres& catalogo = catalogoNombres();
+    
+    // Decide si es hombre o mujer
+    bool esHombre = enteroAleatorio(motor, 2);
+    
+    // Selecciona nombre según género (del catálogo: no se copia)
+    Texto nombre = esHombre ? 
+        catalogo.masculinos[enteroAleatorio(motor, nombresMasculinos.size())] :
+        catalogo.femeninos[enteroAleatorio(motor, nombresFemeninos.size())];
+    
+    // Apellido compuesto (dos apellidos aleatorios, en este orden), ya armado en el catálogo
+    size_t primero = enteroAleatorio(motor, apellidos.size());
+    size_t segundo = enteroAleatorio(motor, apellidos.size());
+    Texto apellido = catalogo.apellidosCompuestos[primero * apellidos.size() + segundo];
+    
+    // Genera los demás atributos
+    char grupo = generarGrupoDIAN(id); // Se calcula una sola vez
+    CiudadId ciudad = static_cast<CiudadId>(enteroAleatorio(motor, NUM_CIUDADES));
+    uint32_t fecha = generarFechaNacimiento(motor);
+    
+    // Genera datos financieros realistas
+    double ingresos = decimalAleatorio(motor, 10000000, 500000000);   // 10M a 500M COP
+    double patrimonio = decimalAleatorio(motor, 0, 2000000000);       // 0 a 2,000M COP
+    double deudas = decimalAleatorio(motor, 0, patrimonio * 0.7);     // Deudas hasta el 70% del patrimonio
+    bool declarante = (ingresos > 50000000) && (enteroAleatorio(motor, 100) > 30); // Probabilidad 70% si ingresos > 50M
+    
+    return Acceso::crear(nombre, apellido, id, grupo, ciudad, fecha, ingresos, patrimonio, deudas, declarante);
+}
+
+Persona generarPersona() {
+    return generarPersona(motorCompartido(), generarID());
+}
+
+// Instanciaciones explícitas para los motores disponibles (ver aleatorio.h)
+template uint32_t generarFechaNacimiento<MotorAleatorio>(MotorAleatorio&);
+template uint32_t generarFechaNacimiento<MotorXoshiro>(MotorXoshiro&);
+template Persona generarPersona<MotorAleatorio>(MotorAleatorio&, uint64_t);
+template Persona generarPersona<MotorXoshiro>(MotorXoshiro&, uint64_t);
+
+/**
+ * Llena 'personas' por bloques, cada uno con su propio motor de tipo Motor.
+ * 
+ * POR QUÉ: El bucle de generación es el mismo para ambos motores.
+ * CÓMO: Cada bloque siembra su motor con (semilla, bloque) y escribe solo en sus posiciones.
+ *       'desde' (múltiplo de BLOQUE_GENERACION) es la posición global de personas[0], para
+ *       generar por partes exactamente la misma colección.
+ * PARA QUÉ: Resultado idéntico para cualquier número de hilos y para el modo por lotes.
+ */
+template <typename Motor>
+static void llenarColeccion(std::vector<Persona>& personas, size_t desde, uint64_t primerID,
+                            uint64_t semilla, unsigned hilos) {
+    size_t primerBloque = desde / BLOQUE_GENERACION;
+    paraCadaBloque(personas.size(), BLOQUE_GENERACION, hilos,
+        [&](size_t bloque, size_t inicio, size_t fin) {
+            Fase fase("bloque");
+            Motor motor(semillaDeBloque(semilla, primerBloque + bloque));
+            for (size_t i = inicio; i < fin; ++i) {
+                personas[i] = generarPersona(motor, primerID + desde + i);
+            }
+        });
+}
+
+/**
+ * Llenado común de las dos versiones de generarColeccion.
+ * 
+ * POR QUÉ: Generar 2M personas en un solo hilo con rand() toma varios segundos.
+ * CÓMO: Vector con su tamaño final, IDs desde primerID y bloques de
+ *       BLOQUE_GENERACION personas repartidos entre hilos (llenarColeccion).
+ * PARA QUÉ: Generación paralela con resultado idéntico para cualquier número de hilos.
+ */
+static std::vector<Persona> generarColeccionDesde(int n, uint64_t primerID, uint64_t semilla,
+                                                  unsigned hilos, TipoMotor tipo) {
+    Fase fase("generación");
+    std::vector<Persona> personas(n);
+    
+    if (tipo == TipoMotor::Mersenne) llenarColeccion<MotorAleatorio>(personas, 0, primerID, semilla, hilos);
+    else llenarColeccion<MotorXoshiro>(personas, 0, primerID, semilla, hilos);
+    
+    return personas;
+}
+
+/**
+ * Implementación de generarColeccion.
+ * 
+ * POR QUÉ: Con el contador global, regenerar o generar otro tamaño desplazaba los
+ *          IDs y con ellos los grupos DIAN, aunque la semilla fuera la misma.
+ * CÓMO: Cada colección sembrada numera desde PRIMER_ID.
+ * PARA QUÉ: Que (n, semilla, tipo) determine toda la colección, IDs incluidos.
+ */
+std::vector<Persona> generarColeccion(int n, uint64_t semilla, unsigned hilos, TipoMotor tipo) {
+    return generarColeccionDesde(n, PRIMER_ID, semilla, hilos, tipo);
+}
+
+std::vector<Persona> generarColeccion(int n) {
+    return generarColeccionDesde(n, reservarIDs(n), motorCompartido()(), 0, TipoMotor::Xoshiro);
+}
+
+/**
+ * Implementación de buscarPorID.
+ * 
+ * POR QUÉ: Encontrar una persona por su ID en una colección.
+ * CÓMO: Usando un algoritmo de búsqueda secuencial (lineal).
+ * PARA QUÉ: Para operaciones de búsqueda en la aplicación.
+ */
+const Persona* buscarPorID(const std::vector<Persona>& personas, uint64_t id) {
+    // Usa find_if con una lambda para buscar por ID
+    auto it = std::find_if(personas.begin(), personas.end(),
+        [id](const Persona& p) { return Acceso::idDe(p) == id; });
+    
+    if (it != personas.end()) {
+        return &(*it); // Devuelve puntero a la persona encontrada
+    } else {
+        return nullptr; // No encontrado
+    }
+}
+
+/**
+ * Implementación de generarGrupoDIAN.
+ * 
+ * POR QUÉ: Clasificar contribuyentes según el calendario tributario DIAN 2025.
+ * CÓMO: Tomando los dos últimos dígitos del ID (id % 100) y aplicando las reglas.
+ * PARA QUÉ: Determinar fechas de declaración de renta.
+ */
+char generarGrupoDIAN(uint64_t id) {
+    // Los dos últimos dígitos del documento, sin pasar por texto
+    int digitos = static_cast<int>(id % 100);
+    
+    // Aplica las reglas del calendario tributario DIAN 2025
+    if (digitos >= 0 && digitos <= 39) {
+        return 'A'; // Grupo A: 00-39
+    } else if (digitos >= 40 && digitos <= 79) {
+        return 'B'; // Grupo B: 40-79
+    } else { // digitos >= 80 && digitos <= 99
+        return 'C'; // Grupo C: 80-99
+    }
+}
+
+/**
+ * Imprime el reporte de ciudades por patrimonio promedio.
+ * 
+ * POR QUÉ: La versión con objetos y la columnar producen el mismo resultado.
+ * CÓMO: Recorriendo los promedios ya ordenados.
+ * PARA QUÉ: Un solo formato de reporte para ambos modos.
+ */
+static void imprimirCiudadesPorPatrimonio(const std::vector<PromedioCiudad>& ciudadesPromedio) {
+    Fase fase("salida");
+    std::cout << "\n=== CIUDADES POR PATRIMONIO PROMEDIO (MAYOR A MENOR) ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t i = 0; i < ciudadesPromedio.size(); ++i) {
+        const auto& ciudad = ciudadesPromedio[i];
+        std::cout << (i + 1) << ". " << nombreCiudad(ciudad.ciudad) 
+                  << ": $" << ciudad.promedio 
+                  << " (Población: " << ciudad.poblacion << " personas)\n";
+    }
+}
+
+/**
+ * Imprime el reporte de mayores de 60 años por calendario DIAN.
+ * 
+ * POR QUÉ: La versión con objetos y la columnar producen el mismo conteo.
+ * CÓMO: Calculando porcentajes por grupo y el resumen nacional.
+ * PARA QUÉ: Un solo formato de reporte para ambos modos.
+ */
+static void imprimirMayores60(const ConteoMayores60& conteo) {
+    Fase fase("salida");
+    std::cout << "\n=== ANÁLISIS DEMOGRÁFICO: PERSONAS > 60 AÑOS POR CALENDARIO DIAN ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    size_t totalMayores60 = 0;
+    size_t totalPersonas = 0;
+
+    for (char grupo : {'A', 'B', 'C'}) {
+        int g = indiceGrupo(grupo);
+        std::cout << "\n📅 GRUPO " << grupo << " (Terminación ";
+        if (grupo == 'A') std::cout << "00-39";
+        else if (grupo == 'B') std::cout << "40-79";
+        else std::cout << "80-99";
+        std::cout << "):\n";
+
+        size_t total = conteo.total[g];
+        size_t mayores = conteo.mayores60[g];
+        double porcentaje = (total > 0) ? (static_cast<double>(mayores) / total) * 100.0 : 0.0;
+
+        std::cout << "   Total personas: " << total << "\n";
+        std::cout << "   Mayores de 60 años: " << mayores << "\n";
+        std::cout << "   Porcentaje: " << porcentaje << "%\n";
+
+        totalMayores60 += mayores;
+        totalPersonas += total;
+    }
+
+    double porcentajeGeneral = (totalPersonas > 0) ? 
+        (static_cast<double>(totalMayores60) / totalPersonas) * 100.0 : 0.0;
+
+    std::cout << "\n📊 RESUMEN GENERAL:\n";
+    std::cout << "   Total nacional: " << totalPersonas << " personas\n";
+    std::cout << "   Mayores de 60 años: " << totalMayores60 << " personas\n";
+    std::cout << "   Porcentaje nacional: " << porcentajeGeneral << "%\n";
+}
+
+/**
+ * Imprime la persona más longeva de cada ciudad.
+ * 
+ * POR QUÉ: Los modos de objetos, columnar y por lotes llegan a las mismas personas por caminos distintos.
+ * CÓMO: Recorriendo las ciudades en orden alfabético; nullptr = ciudad sin personas.
+ * PARA QUÉ: Un solo formato de reporte para los tres modos.
+ */
+static void imprimirLongevasPorCiudad(const std::array<const Persona*, NUM_CIUDADES>& longevas) {
+    Fase fase("salida");
+    std::cout << "\n=== PERSONAS MÁS LONGEVAS POR CIUDAD ===\n";
+    for (CiudadId ciudad : ciudadesPorNombre()) {
+        const Persona* persona = longevas[ciudad];
+        if (!persona) continue;
+        std::cout << "📍 " << nombreCiudad(ciudad) << ": " 
+                  << Acceso::nombreDe(*persona) << " " << Acceso::apellidoDe(*persona)
+                  << " (ID: " << Acceso::idDe(*persona) << ") - " 
+                  << Acceso::edadDe(*persona) << " años\n";
+    }
+}
+
+// Imprime la persona con mayor patrimonio de cada ciudad (mismo criterio que la anterior)
+static void imprimirMayorPatrimonioPorCiudad(const std::array<const Persona*, NUM_CIUDADES>& mayores) {
+    Fase fase("salida");
+    std::cout << "\n=== MAYOR PATRIMONIO POR CIUDAD ===\n";
+    for (CiudadId ciudad : ciudadesPorNombre()) {
+        const Persona* persona = mayores[ciudad];
+        if (!persona) continue;
+        std::cout << "📍 " << nombreCiudad(ciudad) << ": " 
+                  << Acceso::nombreDe(*persona) << " " << Acceso::apellidoDe(*persona)
+                  << " (ID: " << Acceso::idDe(*persona) << ") - $" 
+                  << std::fixed << std::setprecision(2) << Acceso::patrimonioDe(*persona) << "\n";
+    }
+}
+
+// Imprime la persona con mayor patrimonio de cada grupo DIAN (posiciones A, B, C)
+static void imprimirMayorPatrimonioPorGrupo(const std::array<const Persona*, 3>& mayores) {
+    Fase fase("salida");
+    std::cout << "\n=== MAYOR PATRIMONIO POR GRUPO DIAN ===\n";
+    for (char grupo : {'A', 'B', 'C'}) {
+        const Persona* persona = mayores[indiceGrupo(grupo)];
+        if (!persona) continue;
+        std::cout << " Grupo " << grupo << ": " 
+                  << Acceso::nombreDe(*persona) << " " << Acceso::apellidoDe(*persona)
+                  << " (ID: " << Acceso::idDe(*persona) << ") - $" 
+                  << std::fixed << std::setprecision(2) << Acceso::patrimonioDe(*persona) << "\n";
+    }
+}
+
+// Persona de una fila para imprimirla: referencia en el vector, copia en la colección (la
+// vista no guarda las filas que solo se listan)
+static const Persona& personaDeFila(const std::vector<Persona>& personas, size_t fila) { return personas[fila]; }
+static Persona personaDeFila(const ColeccionPersonas& personas, size_t fila) { return personas.persona(fila); }
+
+// Personas de las filas de un análisis (SIN_FILA = nullptr)
+template <size_t N>
+static std::array<const Persona*, N> personasDeFilas(const std::vector<Persona>& personas,
+                                                    const std::array<size_t, N>& filas) {
+    std::array<const Persona*, N> resultado;
+    for (size_t k = 0; k < N; ++k) resultado[k] = (filas[k] == SIN_FILA) ? nullptr : &personas[filas[k]];
+    return resultado;
+}
+
+// En la colección, las personas se copian a 'copias' y se apunta a ellas
+template <size_t N>
+static std::array<const Persona*, N> personasDeFilas(const ColeccionPersonas& personas,
+                                                    const std::array<size_t, N>& filas,
+                                                    std::array<Persona, N>& copias) {
+    std::array<const Persona*, N> resultado;
+    for (size_t k = 0; k < N; ++k) {
+        if (filas[k] == SIN_FILA) {
+            resultado[k] = nullptr;
+        } else {
+            copias[k] = personas.persona(filas[k]);
+            resultado[k] = &copias[k];
+        }
+    }
+    return resultado;
+}
+
+// Copia de la persona de 'fila' en 'copia' (SIN_FILA = nullptr)
+static const Persona* copiarFila(const ColeccionPersonas& personas, size_t fila, Persona& copia) {
+    if (fila == SIN_FILA) return nullptr;
+    copia = personas.persona(fila);
+    return &copia;
+}
+
+/**
+ * Escribe el reporte de declarantes por calendario DIAN.
+ * 
+ * POR QUÉ: Guardar un vector de punteros por grupo (con crecimiento sin reservar)
+ *          e imprimir con iostream hacía de esta la opción más lenta y con más memoria.
+ * CÓMO: Con el conteo ya hecho, un segundo recorrido llena un único arreglo de filas
+ *       preasignado (solo las de la página pedida, ordenadas por grupo) y se escribe
+ *       todo en un BufferSalida. Los modos de objetos y columnar solo cambian grupoDe/esDeclarante.
+ * PARA QUÉ: Reporte completo, paginado o solo con conteos, en dos pasadas y sin iostream.
+ */
+template <typename Personas, typename GrupoDe, typename EsDeclarante>
+static void escribirDeclarantes(const Personas& personas, const ConteoDeclarantes& conteo,
+                                GrupoDe grupoDe, EsDeclarante esDeclarante,
+                                BufferSalida& salida, const PaginaListado& pagina) {
+    // Filas a mostrar de cada grupo y su posición inicial en el arreglo de filas
+    std::array<size_t, 3> mostrar{};
+    std::array<size_t, 3> inicio{};
+    size_t totalMostrar = 0;
+    for (int g = 0; g < 3; ++g) {
+        size_t disponibles = (conteo.declarantes[g] > pagina.desde) ? conteo.declarantes[g] - pagina.desde : 0;
+        mostrar[g] = std::min(disponibles, pagina.cantidad);
+        inicio[g] = totalMostrar;
+        totalMostrar += mostrar[g];
+    }
+
+    // Segundo recorrido: un único arreglo de filas, ordenado por grupo y luego por fila
+    std::vector<uint32_t> filas(totalMostrar);
+    std::array<size_t, 3> vistos{};
+    std::array<size_t, 3> llenos{};
+    size_t pendientes = totalMostrar;
+    for (size_t i = 0; i < personas.size() && pendientes > 0; ++i) {
+        if (!esDeclarante(i)) continue;
+        int g = indiceGrupo(grupoDe(i));
+        if (vistos[g]++ < pagina.desde || llenos[g] == mostrar[g]) continue;
+        filas[inicio[g] + llenos[g]++] = static_cast<uint32_t>(i);
+        --pendientes;
+    }
+
+    Fase fase("salida");
+    salida.agregar("\n=== 📅 DECLARANTES DE RENTA POR CALENDARIO TRIBUTARIO ===\n");
+    for (char grupo : {'A', 'B', 'C'}) {
+        int g = indiceGrupo(grupo);
+        salida.agregar("\n GRUPO ");
+        salida.agregar(grupo);
+        salida.agregar(" (Terminación ");
+        salida.agregar(grupo == 'A' ? "00-39" : (grupo == 'B' ? "40-79" : "80-99"));
+        salida.agregar("):\n   Total personas en grupo: ");
+        salida.agregarEntero(conteo.total[g]);
+        salida.agregar("\n   Declarantes de renta: ");
+        salida.agregarEntero(conteo.declarantes[g]);
+        salida.agregar('\n');
+        if (mostrar[g] == 0) continue;
+
+        if (mostrar[g] == conteo.declarantes[g]) {
+            salida.agregar("   Lista de declarantes:\n");
+        } else {
+            salida.agregar("   Lista de declarantes (");
+            salida.agregarEntero(pagina.desde + 1);
+            salida.agregar('-');
+            salida.agregarEntero(pagina.desde + mostrar[g]);
+            salida.agregar(" de ");
+            salida.agregarEntero(conteo.declarantes[g]);
+            salida.agregar("):\n");
+        }
+        for (size_t k = inicio[g]; k < inicio[g] + mostrar[g]; ++k) {
+            const Persona& persona = personaDeFila(personas, filas[k]);
+            salida.agregar("   • ");
+            salida.agregar(Acceso::nombreDe(persona));
+            salida.agregar(' ');
+            salida.agregar(Acceso::apellidoDe(persona));
+            salida.agregar(" (ID: ");
+            salida.agregarEntero(Acceso::idDe(persona));
+            salida.agregar(") - $");
+            salida.agregarDecimal2(Acceso::ingresosDe(persona));
+            salida.agregar('\n');
+        }
+    }
+    salida.vaciar();
+}
+
+/**
+ * Análisis de las opciones 4-8 sobre los objetos Persona.
+ *
+ * POR QUÉ: Son los mismos recorridos del almacén columnar y de los diseños de la opción 32;
+ *          escribirlos otra vez aquí obligaba a repetir cada corrección en cada copia.
+ * CÓMO: Analitica (analitica.h) con AccesoPersona, que lee cada campo con los métodos
+ *       o los campos de Persona según la variante; la colección llega por referencia a
+ *       Analitica (en las variantes de valor la copia ya ocurrió en la firma de la
+ *       función que llama, ver ParametroPersonas en generador.h).
+ * PARA QUÉ: Un solo recorrido por análisis para objetos, filas compactas y columnas.
+ */
+using AnalisisPersonas = Analitica<AccesoPersona, PasoReferencia>;
+
+const Persona* encontrarPersonaMasLongeva(const std::vector<Persona>& personas) {
+    // Un solo grupo (todo el país); nullptr si la colección está vacía
+    size_t fila = AnalisisPersonas::masLongeva(personas);
+    return (fila == SIN_FILA) ? nullptr : &personas[fila];
+}
+
+void encontrarLongevasPorCiudad(const std::vector<Persona>& personas) {
+    // Arreglo indexado por CiudadId (nullptr = ciudad sin personas), calculado en paralelo
+    imprimirLongevasPorCiudad(personasDeFilas(personas, AnalisisPersonas::longevasPorCiudad(personas)));
+}
+
+const Persona* encontrarMayorPatrimonio(const std::vector<Persona>& personas) {
+    // Un solo grupo (todo el país); nullptr si la colección está vacía
+    size_t fila = AnalisisPersonas::mayorPatrimonio(personas);
+    return (fila == SIN_FILA) ? nullptr : &personas[fila];
+}
+
+void encontrarMayorPatrimonioPorCiudad(const std::vector<Persona>& personas) {
+    // Arreglo indexado por CiudadId (nullptr = ciudad sin personas), calculado en paralelo
+    imprimirMayorPatrimonioPorCiudad(personasDeFilas(personas, AnalisisPersonas::mayorPatrimonioPorCiudad(personas)));
+}
+
+void encontrarMayorPatrimonioPorGrupoDIAN(const std::vector<Persona>& personas) {
+    // Arreglo indexado por grupo (A, B, C), calculado en paralelo
+    imprimirMayorPatrimonioPorGrupo(personasDeFilas(personas, AnalisisPersonas::mayorPatrimonioPorGrupo(personas)));
+}
+
+void listarDeclarantesPorGrupo(ParametroPersonas personas) {
+    BufferSalida salida(1); // Salida estándar
+
+    listarDeclarantesPorGrupo(personas, salida, PaginaListado());
+}
+
+void listarDeclarantesPorGrupo(const std::vector<Persona>& personas, BufferSalida& salida,
+                               const PaginaListado& pagina) {
+    // Primer recorrido (paralelo): personas y declarantes por grupo
+    ConteoDeclarantes conteo = AnalisisPersonas::declarantesPorGrupo(personas);
+
+    escribirDeclarantes(personas, conteo,
+        [&](size_t i) { return Acceso::grupoDe(personas[i]); },
+        [&](size_t i) { return Acceso::declaranteDe(personas[i]); },
+        salida, pagina);
+}
+
+/**
+ * Implementación de analizarCiudadesPorPatrimonioPromedio.
+ * 
+ * POR QUÉ: Identificar las ciudades con mayor concentración de riqueza.
+ * CÓMO: Calculando patrimonio promedio por ciudad y ordenando descendentemente.
+ * PARA QUÉ: Análisis económico territorial y toma de decisiones.
+ */
+void analizarCiudadesPorPatrimonioPromedio(ParametroPersonas personas) {
+    // Patrimonio por ciudad en paralelo (arreglos indexados por CiudadId), ordenado descendentemente
+    std::vector<PromedioCiudad> promedios = AnalisisPersonas::ciudadesPorPatrimonioPromedio(personas);
+
+    imprimirCiudadesPorPatrimonio(promedios);
+}
+
+/**
+ * Implementación de analizarPorcentajeMayores60PorCalendario.
+ * 
+ * POR QUÉ: Análisis demográfico de población de tercera edad por grupo tributario.
+ * CÓMO: Contando personas >60 años en cada grupo DIAN y calculando porcentajes.
+ * PARA QUÉ: Estudios de envejecimiento poblacional y políticas públicas.
+ */
+void analizarPorcentajeMayores60PorCalendario(ParametroPersonas personas) {
+    // Contar en paralelo personas y mayores de 60 por grupo (A, B, C)
+    ConteoMayores60 conteo = AnalisisPersonas::mayores60PorGrupo(personas);
+
+    imprimirMayores60(conteo);
+}
+
+// --- Versión columnar ---
+
+// Copia los campos de 'persona' al almacén: al final, o sobre 'fila' si se indica
+static void guardarEnStore(PersonaStore& store, const Persona& persona, size_t fila = SIN_FILA) {
+    uint16_t anio = static_cast<uint16_t>(Acceso::anioDe(persona));
+    if (fila == SIN_FILA) {
+        store.agregar(Acceso::idDe(persona), Acceso::ingresosDe(persona), Acceso::patrimonioDe(persona),
+                      Acceso::deudasDe(persona), Acceso::declaranteDe(persona), Acceso::ciudadDe(persona), anio,
+                      Acceso::grupoDe(persona));
+    } else {
+        store.asignarFila(fila, Acceso::idDe(persona), Acceso::ingresosDe(persona), Acceso::patrimonioDe(persona),
+                          Acceso::deudasDe(persona), Acceso::declaranteDe(persona), Acceso::ciudadDe(persona), anio,
+                          Acceso::grupoDe(persona));
+    }
+}
+
+/**
+ * Implementación de construirStore.
+ * 
+ * POR QUÉ: Copiar una sola vez los campos que usan los análisis y el índice de IDs.
+ * CÓMO: Un recorrido que copia ID, campos numéricos, CiudadId, año y grupo DIAN.
+ * PARA QUÉ: Alimentar las versiones columnares de los análisis.
+ */
+PersonaStore construirStore(const std::vector<Persona>& personas) {
+    PersonaStore store;
+    store.reserve(personas.size());
+
+    for (const auto& persona : personas) {
+        guardarEnStore(store, persona);
+    }
+
+    return store;
+}
+
+const Persona* encontrarPersonaMasLongeva(const ColeccionPersonas& personas, const PersonaStore& store,
+                                          Persona& copia) {
+    return copiarFila(personas, filaMasLongeva(store), copia);
+}
+
+void encontrarLongevasPorCiudad(const ColeccionPersonas& personas, const PersonaStore& store) {
+    std::array<Persona, NUM_CIUDADES> copias;
+    imprimirLongevasPorCiudad(personasDeFilas(personas, filasLongevasPorCiudad(store), copias));
+}
+
+const Persona* encontrarMayorPatrimonio(const ColeccionPersonas& personas, const PersonaStore& store,
+                                        Persona& copia) {
+    return copiarFila(personas, filaMayorPatrimonio(store), copia);
+}
+
+void encontrarMayorPatrimonioPorCiudad(const ColeccionPersonas& personas, const PersonaStore& store) {
+    std::array<Persona, NUM_CIUDADES> copias;
+    imprimirMayorPatrimonioPorCiudad(personasDeFilas(personas, filasMayorPatrimonioPorCiudad(store), copias));
+}
+
+void encontrarMayorPatrimonioPorGrupoDIAN(const ColeccionPersonas& personas, const PersonaStore& store) {
+    std::array<Persona, 3> copias;
+    imprimirMayorPatrimonioPorGrupo(personasDeFilas(personas, filasMayorPatrimonioPorGrupo(store), copias));
+}
+
+/**
+ * Implementación columnar de listarDeclarantesPorGrupo.
+ * 
+ * POR QUÉ: No construir un vector de punteros por grupo.
+ * CÓMO: Conteo sobre columnas y un recorrido de las columnas grupo/declarante
+ *       para llenar el arreglo de filas a mostrar (escribirDeclarantes).
+ * PARA QUÉ: Misma salida sin recorrer los objetos Persona salvo para imprimir.
+ */
+void listarDeclarantesPorGrupo(const ColeccionPersonas& personas, const PersonaStore& store) {
+    BufferSalida salida(1); // Salida estándar
+    listarDeclarantesPorGrupo(personas, store, salida, PaginaListado());
+}
+
+void listarDeclarantesPorGrupo(const ColeccionPersonas& personas, const PersonaStore& store,
+                               BufferSalida& salida, const PaginaListado& pagina) {
+    escribirDeclarantes(personas, contarDeclarantesPorGrupo(store),
+        [&](size_t i) { return store.grupoDIAN[i]; },
+        [&](size_t i) { return store.declaranteRenta[i] != 0; },
+        salida, pagina);
+}
+
+void analizarCiudadesPorPatrimonioPromedio(const PersonaStore& store) {
+    imprimirCiudadesPorPatrimonio(ciudadesPorPatrimonioPromedio(store));
+}
+
+void analizarPorcentajeMayores60PorCalendario(const PersonaStore& store) {
+    imprimirMayores60(contarMayores60PorGrupo(store));
+}
+
+// --- Distribución de riqueza (seleccion.h) ---
+
+// Percentiles de los deciles de patrimonio (D1..D9)
+static const std::vector<double> DECILES = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+
+/**
+ * Calcula e imprime el reporte de distribución de riqueza.
+ * 
+ * POR QUÉ: La versión con objetos y la columnar solo cambian cómo se lee cada campo.
+ * CÓMO: ciudadDe, grupoDe, patrimonioDe e ingresosDe reciben la fila; los montículos
+ *       acotados y los percentiles (o bocetos) de seleccion.h recorren en paralelo.
+ * PARA QUÉ: Un solo cálculo y formato de reporte para ambos modos.
+ */
+template <typename Personas, typename CiudadDe, typename GrupoDe, typename PatrimonioDe, typename IngresosDe>
+static void reportarDistribucion(const Personas& personas, size_t k, bool aproximado,
+                                 CiudadDe ciudadDe, GrupoDe grupoDe, PatrimonioDe patrimonioDe,
+                                 IngresosDe ingresosDe) {
+    size_t total = personas.size();
+    auto todos = [](size_t) { return 0; };
+    std::array<std::vector<Candidato>, NUM_CIUDADES> mayores =
+        mayoresPorGrupo<NUM_CIUDADES>(total, k, ciudadDe, patrimonioDe);
+
+    std::array<std::vector<double>, 1> deciles;
+    std::array<std::vector<double>, 3> medianas;
+    if (aproximado) {
+        BocetoCuantiles patrimonio = bocetosPorGrupo<1>(total, todos, patrimonioDe)[0];
+        std::array<BocetoCuantiles, 3> ingresos = bocetosPorGrupo<3>(total, grupoDe, ingresosDe);
+        double valor;
+        for (double p : DECILES) {
+            if (patrimonio.percentil(p, valor)) deciles[0].push_back(valor);
+        }
+        for (int g = 0; g < 3; ++g) {
+            if (ingresos[g].percentil(50, valor)) medianas[g].push_back(valor);
+        }
+    } else {
+        deciles = percentilesPorGrupo<1>(total, todos, patrimonioDe, DECILES);
+        medianas = percentilesPorGrupo<3>(total, grupoDe, ingresosDe, {50});
+    }
+
+    std::cout << "\n=== " << k << " MAYORES PATRIMONIOS POR CIUDAD ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    for (CiudadId ciudad : ciudadesPorNombre()) {
+        if (mayores[ciudad].empty()) continue;
+        std::cout << "📍 " << nombreCiudad(ciudad) << ":\n";
+        for (size_t i = 0; i < mayores[ciudad].size(); ++i) {
+            const Persona& persona = personaDeFila(personas, mayores[ciudad][i].fila);
+            std::cout << "   " << (i + 1) << ". " << Acceso::nombreDe(persona) << " "
+                      << Acceso::apellidoDe(persona) << " (ID: " << Acceso::idDe(persona) << ") - $"
+                      << Acceso::patrimonioDe(persona) << "\n";
+        }
+    }
+
+    std::cout << "\n=== DECILES DE PATRIMONIO ("
+              << (aproximado ? "aproximados, error relativo <= 1%" : "exactos") << ") ===\n";
+    for (size_t d = 0; d < deciles[0].size(); ++d) {
+        std::cout << " D" << (d + 1) << " (p" << static_cast<int>(DECILES[d]) << "): $" << deciles[0][d] << "\n";
+    }
+
+    std::cout << "\n=== MEDIANA DE INGRESOS POR GRUPO DIAN ===\n";
+    for (char grupo : {'A', 'B', 'C'}) {
+        const std::vector<double>& mediana = medianas[indiceGrupo(grupo)];
+        if (mediana.empty()) continue;
+        std::cout << " Grupo " << grupo << ": $" << mediana[0] << "\n";
+    }
+}
+
+/**
+ * Implementación de analizarDistribucionRiqueza (objetos).
+ * 
+ * POR QUÉ: Los campos se leen de cada Persona, como en los demás análisis sin almacén.
+ * CÓMO: Lambdas de acceso por fila sobre la colección (reportarDistribucion).
+ * PARA QUÉ: Comparar con la versión columnar en el benchmark.
+ */
+void analizarDistribucionRiqueza(const std::vector<Persona>& personas, size_t k, bool aproximado) {
+    reportarDistribucion(personas, k, aproximado,
+        [&](size_t i) { return Acceso::ciudadDe(personas[i]); },
+        [&](size_t i) { return indiceGrupo(Acceso::grupoDe(personas[i])); },
+        [&](size_t i) { return Acceso::patrimonioDe(personas[i]); },
+        [&](size_t i) { return Acceso::ingresosDe(personas[i]); });
+}
+
+void analizarDistribucionRiqueza(const ColeccionPersonas& personas, const PersonaStore& store,
+                                 size_t k, bool aproximado) {
+    const CiudadId* ciudades = store.ciudad.data();
+    const char* grupos = store.grupoDIAN.data();
+    const double* patrimonio = store.patrimonio.data();
+    const double* ingresos = store.ingresosAnuales.data();
+    reportarDistribucion(personas, k, aproximado,
+        [ciudades](size_t i) { return ciudades[i]; },
+        [grupos](size_t i) { return indiceGrupo(grupos[i]); },
+        [patrimonio](size_t i) { return patrimonio[i]; },
+        [ingresos](size_t i) { return ingresos[i]; });
+}
+
+/**
+ * Implementación de buscarPorID (indexada).
+ * 
+ * POR QUÉ: Evitar el recorrido lineal de la versión sin índice.
+ * CÓMO: Pidiendo la fila al índice y copiando esa persona en 'copia'.
+ * PARA QUÉ: Búsqueda en O(1) para la opción 3 del menú.
+ */
+const Persona* buscarPorID(const ColeccionPersonas& personas, const IndiceID& indice, uint64_t id,
+                           Persona& copia) {
+    return copiarFila(personas, indice.buscar(id), copia);
+}
+
+std::vector<size_t> buscarPorIDs(const IndiceID& indice, const std::vector<uint64_t>& ids) {
+    std::vector<size_t> filas;
+    indice.buscarLote(ids, filas);
+    return filas;
+}
+
+/**
+ * Implementación de guardarSnapshot (población).
+ * 
+ * POR QUÉ: El formato guarda nombres y apellidos como índices en un diccionario.
+ * CÓMO: Un recorrido que asigna un índice a cada texto nuevo y copia las fechas; el resto de
+ *       columnas se toma directamente del almacén. Los textos están internados, así que
+ *       basta buscarlos por dirección (unordered_map de punteros, sin comparar bytes).
+ * PARA QUÉ: Un archivo compacto que se abre sin reconstruir strings.
+ */
+bool guardarSnapshot(const std::string& ruta, const ColeccionPersonas& personas,
+                     const PersonaStore& store, std::string& error) {
+    size_t n = personas.size();
+    ColumnasSnapshot columnas;
+    columnas.filas = n;
+    columnas.cadenas = inicioDiccionario();
+
+    std::unordered_map<const char*, uint32_t> indices;
+    auto indiceDe = [&](const Texto& texto) {
+        auto encontrado = indices.find(texto.datos);
+        if (encontrado != indices.end()) return encontrado->second;
+        uint32_t nuevo = static_cast<uint32_t>(columnas.cadenas.size());
+        columnas.cadenas.push_back(texto.str());
+        indices.emplace(texto.datos, nuevo);
+        return nuevo;
+    };
+
+    std::vector<uint32_t> fechas(n), nombres(n), apellidos(n);
+    for (size_t i = 0; i < n; ++i) {
+        Persona persona = personas.persona(i);
+        fechas[i] = Acceso::fechaDe(persona);
+        nombres[i] = indiceDe(Acceso::nombreDe(persona));
+        apellidos[i] = indiceDe(Acceso::apellidoDe(persona));
+    }
+
+    columnas.id = store.id.data();
+    columnas.ingresos = store.ingresosAnuales.data();
+    columnas.patrimonio = store.patrimonio.data();
+    columnas.deudas = store.deudas.data();
+    columnas.fecha = fechas.data();
+    columnas.nombre = nombres.data();
+    columnas.apellido = apellidos.data();
+    columnas.anio = store.anioNacimiento.data();
+    columnas.ciudad = store.ciudad.data();
+    columnas.declarante = store.declaranteRenta.data();
+    columnas.grupo = store.grupoDIAN.data();
+    return guardarSnapshot(ruta, columnas, error);
+}
+
+// Textos del diccionario del snapshot, copiados una sola vez a la arena
+static std::vector<Texto> textosDeSnapshot(const Snapshot& snapshot, ArenaTextos& arena) {
+    std::vector<Texto> textos(snapshot.numCadenas());
+    for (size_t k = 0; k < textos.size(); ++k) {
+        std::string cadena = snapshot.cadena(static_cast<uint32_t>(k));
+        textos[k] = arena.internar(cadena.data(), cadena.size());
+    }
+    return textos;
+}
+
+// Persona de la fila 'f' del snapshot ('textos' = textosDeSnapshot)
+static Persona personaDeSnapshot(const Snapshot& snapshot, const std::vector<Texto>& textos, size_t f) {
+    auto texto = [&](uint32_t k) { return (k < textos.size()) ? textos[k] : Texto(); };
+    return Acceso::crear(texto(snapshot.nombre()[f]), texto(snapshot.apellido()[f]),
+                         snapshot.id()[f], snapshot.grupo()[f], snapshot.ciudad()[f],
+                         snapshot.fecha()[f], snapshot.ingresos()[f], snapshot.patrimonio()[f],
+                         snapshot.deudas()[f], snapshot.declarante()[f] != 0);
+}
+
+// Construye personas[i] con la fila desde + i del snapshot, por bloques en paralelo
+static void llenarDesdeSnapshot(const Snapshot& snapshot, const std::vector<Texto>& textos,
+                                size_t desde, std::vector<Persona>& personas) {
+    paraCadaBloque(personas.size(), BLOQUE_GENERACION, 0, [&](size_t, size_t inicio, size_t fin) {
+        for (size_t i = inicio; i < fin; ++i) personas[i] = personaDeSnapshot(snapshot, textos, desde + i);
+    });
+}
+
+// --- Colección de personas ---
+
+ColeccionPersonas::ColeccionPersonas(std::vector<Persona> personas) : propias(std::move(personas)) {}
+
+ColeccionPersonas::ColeccionPersonas(const Snapshot& snapshot, ArenaTextos& textos)
+    : snapshot(&snapshot), filasVista(snapshot.filas()), textos(textosDeSnapshot(snapshot, textos)) {}
+
+Persona ColeccionPersonas::persona(size_t fila) const {
+    if (!snapshot) return propias[fila];
+    auto armada = armadas.find(fila);
+    return (armada != armadas.end()) ? armada->second : personaDeSnapshot(*snapshot, textos, fila);
+}
+
+void ColeccionPersonas::agregar(const Persona& persona) {
+    if (!snapshot) propias.push_back(persona);
+    else armadas[filasVista++] = persona;
+}
+
+void ColeccionPersonas::reemplazar(size_t fila, const Persona& persona) {
+    if (!snapshot) propias[fila] = persona;
+    else armadas[fila] = persona;
+}
+
+void ColeccionPersonas::quitar(size_t fila) {
+    size_t ultima = size() - 1;
+    if (!snapshot) {
+        propias[fila] = propias[ultima];
+        propias.pop_back();
+        return;
+    }
+    if (fila != ultima) {
+        Persona movida = persona(ultima);
+        armadas[fila] = movida;
+    }
+    armadas.erase(ultima);
+    --filasVista;
+}
+
+/**
+ * Implementación de hacerPropia.
+ * 
+ * CÓMO: Las filas que siguen en el snapshot se llenan en paralelo (llenarDesdeSnapshot) y
+ *       encima se copian las guardadas; las altas quedan al final, como en el vector.
+ */
+void ColeccionPersonas::hacerPropia() {
+    if (!snapshot) return;
+    std::vector<Persona> personas(std::min(filasVista, snapshot->filas()));
+    llenarDesdeSnapshot(*snapshot, textos, 0, personas);
+    personas.resize(filasVista);
+    for (const auto& armada : armadas) personas[armada.first] = armada.second;
+
+    propias = std::move(personas);
+    armadas.clear();
+    snapshot = nullptr;
+}
+
+/**
+ * Implementación de exportarCsv.
+ * 
+ * POR QUÉ: Con iostream, escribir millones de filas tarda decenas de segundos.
+ * CÓMO: Un RegistroCsv por persona (los textos apuntan a los strings de la persona)
+ *       formateado por escribirRegistroCsv en el buffer.
+ * PARA QUÉ: Exportar el conjunto completo al ritmo del disco o del pipe.
+ */
+void exportarCsv(const ColeccionPersonas& personas, BufferSalida& salida) {
+    salida.agregar(CABECERA_CSV);
+    RegistroCsv registro;
+    for (size_t i = 0; i < personas.size(); ++i) {
+        Persona p = personas.persona(i);
+        registro.id = Acceso::idDe(p);
+        registro.nombre.datos = Acceso::nombreDe(p).data();
+        registro.nombre.largo = Acceso::nombreDe(p).size();
+        registro.apellido.datos = Acceso::apellidoDe(p).data();
+        registro.apellido.largo = Acceso::apellidoDe(p).size();
+        registro.fecha = Acceso::fechaDe(p);
+        registro.ciudad = Acceso::ciudadDe(p);
+        registro.ingresos = Acceso::ingresosDe(p);
+        registro.patrimonio = Acceso::patrimonioDe(p);
+        registro.deudas = Acceso::deudasDe(p);
+        registro.declarante = Acceso::declaranteDe(p);
+        escribirRegistroCsv(salida, registro);
+    }
+}
+
+// Persona de una fila CSV con sus textos internados en 'textos' (el grupo DIAN se deriva del ID, como al generar)
+static Persona personaDesdeRegistro(const RegistroCsv& r, ArenaTextos& textos) {
+    return Acceso::crear(textos.internar(r.nombre), textos.internar(r.apellido), r.id, generarGrupoDIAN(r.id),
+                         r.ciudad, r.fecha, r.ingresos, r.patrimonio, r.deudas, r.declarante);
+}
+
+/**
+ * Implementación de importarCsv.
+ * 
+ * POR QUÉ: Los extractos reales tienen decenas de millones de filas.
+ * CÓMO: Se llena un vector nuevo (el de salida solo se reemplaza si todo el archivo es válido);
+ *       cada fila se construye en su posición desde el hilo que analizó su trozo, internando
+ *       nombre y apellido en la arena (cada texto distinto se guarda una vez). Un IndiceID
+ *       sobre los IDs leídos detecta los repetidos: el índice, las altas y las bajas
+ *       suponen IDs únicos.
+ * PARA QUÉ: Cargar el archivo a la velocidad de la caché de páginas.
+ */
+bool importarCsv(const std::string& ruta, std::vector<Persona>& personas, ArenaTextos& textos,
+                 std::string& error) {
+    std::unique_ptr<LectorCsv> lector = LectorCsv::abrir(ruta, error);
+    if (!lector) return false;
+
+    std::vector<Persona> leidas(lector->filas());
+    std::vector<uint64_t> ids(lector->filas());
+    bool correcto = lector->recorrer([&](size_t fila, const RegistroCsv& r) {
+        leidas[fila] = personaDesdeRegistro(r, textos);
+        ids[fila] = r.id;
+    }, error);
+    if (!correcto) return false;
+
+    // El índice guarda la primera fila de cada ID: la primera fila que no es la suya repite uno
+    IndiceID indice;
+    indice.construir(ids.data(), ids.size());
+    if (indice.size() < ids.size()) {
+        for (size_t i = 0; i < ids.size(); ++i) {
+            size_t primera = indice.buscar(ids[i]);
+            if (primera == i) continue;
+            error = "línea " + std::to_string(lector->lineaDeFila(i)) + ": ID " + std::to_string(ids[i]) +
+                    " repetido (ya está en la línea " + std::to_string(lector->lineaDeFila(primera)) + ")";
+            return false;
+        }
+    }
+
+    personas = std::move(leidas);
+    return true;
+}
+
+/**
+ * Imprime todos los análisis de un AnalisisCompleto (modo por lotes, opciones 23 y 24).
+ *
+ * CÓMO: 'ganador(k)' entrega la persona de AnalisisCompleto::ganadores[k] (nullptr si no
+ *       hay); los declarantes se informan solo con sus conteos.
+ */
+template <typename Ganador>
+static void imprimirAnalisisCompleto(const AnalisisCompleto& analisis, Ganador ganador) {
+    Fase fase("salida");
+    std::array<const Persona*, NUM_CIUDADES> longevas, mayoresCiudad;
+    for (CiudadId c = 0; c < NUM_CIUDADES; ++c) {
+        longevas[c] = ganador(ganadorLongevaCiudad(c));
+        mayoresCiudad[c] = ganador(ganadorPatrimonioCiudad(c));
+    }
+    std::array<const Persona*, 3> mayoresGrupo;
+    for (int g = 0; g < 3; ++g) mayoresGrupo[g] = ganador(ganadorPatrimonioGrupo(g));
+
+    if (const Persona* longeva = ganador(GANADOR_LONGEVA)) {
+        std::cout << "\n PERSONA MÁS LONGEVA DEL PAÍS:\n";
+        longeva->mostrar();
+        std::cout << "Edad aproximada: " << Acceso::edadDe(*longeva) << " años\n";
+    }
+    imprimirLongevasPorCiudad(longevas);
+    if (const Persona* rica = ganador(GANADOR_PATRIMONIO)) {
+        std::cout << "\n MAYOR PATRIMONIO DEL PAÍS:\n";
+        rica->mostrar();
+    }
+    imprimirMayorPatrimonioPorCiudad(mayoresCiudad);
+    imprimirMayorPatrimonioPorGrupo(mayoresGrupo);
+
+    // Declarantes: solo conteos (el listado completo está en las opciones 6 y 17)
+    {
+        BufferSalida salida(1);
+        PaginaListado soloConteo;
+        soloConteo.cantidad = 0;
+        const std::vector<Persona> ninguna;
+        escribirDeclarantes(ninguna, analisis.declarantes,
+            [](size_t) { return 'A'; }, [](size_t) { return false; }, salida, soloConteo);
+    }
+    imprimirCiudadesPorPatrimonio(promediosOrdenados(analisis.patrimonio));
+    imprimirMayores60(analisis.mayores60);
+}
+
+/**
+ * Implementación de analizarTodo.
+ *
+ * POR QUÉ: Pedir las opciones 4-8 una tras otra recorre las columnas en cada una.
+ * CÓMO: analisisCompleto hace una sola pasada paralela sobre el almacén; los ganadores
+ *       son filas, que se copian de la colección.
+ * PARA QUÉ: El reporte completo en el tiempo de un recorrido de memoria.
+ */
+void analizarTodo(const ColeccionPersonas& personas, const PersonaStore& store) {
+    AnalisisCompleto analisis = analisisCompleto(store);
+    std::array<Persona, NUM_GANADORES> copias;
+    auto ganador = [&](size_t k) { return copiarFila(personas, analisis.ganadores[k].fila, copias[k]); };
+    std::cout << "\n=== TODOS LOS ANÁLISIS (UNA PASADA) ===\n"
+              << "Personas: " << store.size() << "\n";
+    imprimirAnalisisCompleto(analisis, ganador);
+}
+
+/**
+ * Implementación de mostrarAgregados.
+ *
+ * CÓMO: AgregadosPersonas::consultar devuelve los agregados mantenidos; solo recorre el
+ *       almacén si una baja o un cambio dejó algún ganador por recalcular.
+ */
+void mostrarAgregados(const ColeccionPersonas& personas, const PersonaStore& store,
+                      AgregadosPersonas& agregados) {
+    size_t pendientes = agregados.ganadoresPendientes();
+    const AnalisisCompleto& analisis = agregados.consultar(store);
+    std::array<Persona, NUM_GANADORES> copias;
+    auto ganador = [&](size_t k) { return copiarFila(personas, analisis.ganadores[k].fila, copias[k]); };
+    std::cout << "\n=== AGREGADOS MANTENIDOS ===\n"
+              << "Personas: " << store.size() << " | Ganadores recalculados: " << pendientes << "\n";
+    imprimirAnalisisCompleto(analisis, ganador);
+}
+
+// --- Altas, cambios y bajas ---
+
+/**
+ * Implementación de agregarPersona.
+ * 
+ * CÓMO: La persona va al final de la colección y del almacén; el índice y los agregados
+ *       se actualizan con su fila, sin recorrer el resto.
+ */
+bool agregarPersona(const RegistroCsv& datos, ColeccionPersonas& personas, ArenaTextos& textos,
+                    PersonaStore& store, IndiceID& indice, AgregadosPersonas& agregados, std::string& error) {
+    if (indice.buscar(datos.id) != SIN_FILA) {
+        error = "ya existe una persona con ID " + std::to_string(datos.id);
+        return false;
+    }
+    store.hacerPropio();
+    Persona persona = personaDesdeRegistro(datos, textos);
+    personas.agregar(persona);
+    guardarEnStore(store, persona);
+    size_t fila = personas.size() - 1;
+    indice.agregar(datos.id, fila);
+    agregados.sumarFila(store, fila);
+    return true;
+}
+
+/**
+ * Implementación de modificarPersona.
+ * 
+ * CÓMO: Los agregados restan los valores anteriores de la fila y suman los nuevos;
+ *       la fila y el ID no cambian, así que el índice queda igual.
+ */
+bool modificarPersona(const RegistroCsv& datos, ColeccionPersonas& personas, ArenaTextos& textos,
+                      PersonaStore& store, const IndiceID& indice, AgregadosPersonas& agregados,
+                      std::string& error) {
+    size_t fila = indice.buscar(datos.id);
+    if (fila == SIN_FILA) {
+        error = "no existe una persona con ID " + std::to_string(datos.id);
+        return false;
+    }
+    store.hacerPropio();
+    agregados.restarFila(store, fila);
+    Persona persona = personaDesdeRegistro(datos, textos);
+    personas.reemplazar(fila, persona);
+    guardarEnStore(store, persona, fila);
+    agregados.sumarFila(store, fila);
+    return true;
+}
+
+/**
+ * Implementación de eliminarPersona.
+ * 
+ * CÓMO: La última persona ocupa el lugar de la eliminada (en la colección y en el almacén,
+ *       PersonaStore::quitarFila); el índice y los agregados se enteran de su nueva fila.
+ */
+bool eliminarPersona(uint64_t id, ColeccionPersonas& personas, PersonaStore& store, IndiceID& indice,
+                     AgregadosPersonas& agregados, std::string& error) {
+    size_t fila = indice.buscar(id);
+    if (fila == SIN_FILA) {
+        error = "no existe una persona con ID " + std::to_string(id);
+        return false;
+    }
+    store.hacerPropio();
+    agregados.restarFila(store, fila);
+    indice.quitar(id);
+
+    size_t ultima = personas.size() - 1;
+    personas.quitar(fila);
+    store.quitarFila(fila);
+    if (fila != ultima) {
+        indice.reubicar(store.id[fila], fila);
+        agregados.moverFila(store, ultima, fila);
+    }
+    return true;
+}
+
+// --- Índices ordenados ---
+
+// Valor de un campo de índice: monto con centavos o fecha
+static void imprimirValorCampo(CampoOrden campo, double valor) {
+    if (campo == CampoOrden::FechaNacimiento) std::cout << formatearFecha(static_cast<uint32_t>(valor));
+    else std::cout << "$" << std::fixed << std::setprecision(2) << valor;
+}
+
+// Lista personas numeradas con el valor del campo indexado
+static void imprimirFilasOrden(const ColeccionPersonas& personas, const std::vector<size_t>& filas,
+                               CampoOrden campo) {
+    for (size_t i = 0; i < filas.size(); ++i) {
+        Persona p = personas.persona(filas[i]);
+        std::cout << std::setw(3) << i + 1 << ". ";
+        double clave = (campo == CampoOrden::FechaNacimiento) ? Acceso::fechaDe(p)
+                           : (campo == CampoOrden::Patrimonio) ? Acceso::patrimonioDe(p)
+                           : (campo == CampoOrden::Ingresos) ? Acceso::ingresosDe(p) : Acceso::deudasDe(p);
+        imprimirValorCampo(campo, clave);
+        std::cout << " - ";
+        p.mostrarResumen();
+        std::cout << "\n";
+    }
+}
+
+/**
+ * Implementación de construirIndiceOrden.
+ * 
+ * CÓMO: Patrimonio, ingresos y deudas se indexan directamente desde su columna; la fecha
+ *       de nacimiento (que el almacén no tiene) se copia antes a un arreglo en paralelo.
+ */
+IndiceOrden construirIndiceOrden(const ColeccionPersonas& personas, const PersonaStore& store, CampoOrden campo) {
+    const double* claves = nullptr;
+    std::vector<double> fechas;
+    switch (campo) {
+        case CampoOrden::Patrimonio: claves = store.patrimonio.data(); break;
+        case CampoOrden::Ingresos: claves = store.ingresosAnuales.data(); break;
+        case CampoOrden::Deudas: claves = store.deudas.data(); break;
+        case CampoOrden::FechaNacimiento:
+            fechas.resize(personas.size());
+            paraCadaBloque(personas.size(), BLOQUE_REDUCCION, 0, [&](size_t, size_t inicio, size_t fin) {
+                for (size_t i = inicio; i < fin; ++i) fechas[i] = Acceso::fechaDe(personas.persona(i));
+            });
+            claves = fechas.data();
+            break;
+    }
+
+    IndiceOrden indice;
+    indice.construir(claves, store.ciudad.data(), store.size());
+    return indice;
+}
+
+/**
+ * Implementación de consultarIndiceOrden.
+ * 
+ * CÓMO: Cada consulta son unas pocas búsquedas binarias en el índice; solo se leen las
+ *       personas que se imprimen.
+ */
+void consultarIndiceOrden(const ColeccionPersonas& personas, const IndiceOrden& indice, CampoOrden campo,
+                          const ConsultaOrden& consulta) {
+    std::string ambito = (consulta.ciudad == CIUDAD_INVALIDA) ? "todas las ciudades" : nombreCiudad(consulta.ciudad);
+    switch (consulta.tipo) {
+        case TipoConsultaOrden::Mayores:
+        case TipoConsultaOrden::Menores: {
+            bool mayores = consulta.tipo == TipoConsultaOrden::Mayores;
+            std::cout << "\n=== " << consulta.cantidad << (mayores ? " MAYORES" : " MENORES") << " POR "
+                      << nombreCampoOrden(campo) << " (" << ambito << ") ===\n";
+            imprimirFilasOrden(personas, mayores ? indice.mayores(consulta.cantidad, consulta.ciudad)
+                                                 : indice.menores(consulta.cantidad, consulta.ciudad), campo);
+            break;
+        }
+        case TipoConsultaOrden::Percentil: {
+            double valor;
+            std::cout << "\nPercentil " << consulta.percentil << " de " << nombreCampoOrden(campo)
+                      << " (" << ambito << "): ";
+            if (indice.percentil(consulta.percentil, consulta.ciudad, valor)) imprimirValorCampo(campo, valor);
+            else std::cout << "sin datos";
+            std::cout << "\n";
+            break;
+        }
+        case TipoConsultaOrden::Rango: {
+            std::cout << "\n=== " << nombreCampoOrden(campo) << " ENTRE ";
+            imprimirValorCampo(campo, consulta.desde);
+            std::cout << " Y ";
+            imprimirValorCampo(campo, consulta.hasta);
+            std::cout << " (" << ambito << ") ===\n"
+                      << "Personas: " << indice.contar(consulta.desde, consulta.hasta, consulta.ciudad) << "\n";
+            imprimirFilasOrden(personas, indice.filasEnRango(consulta.desde, consulta.hasta, consulta.ciudad,
+                                                             consulta.cantidad), campo);
+            break;
+        }
+    }
+}
+
+// Memoria de una fila durante un lote: la Persona y su fila del almacén (los textos van a la arena)
+static const size_t BYTES_FILA_LOTE = sizeof(Persona) + BYTES_FILA_STORE;
+
+/**
+ * Implementación de analizarPorLotes.
+ * 
+ * POR QUÉ: Con el conjunto completo en memoria, el tamaño máximo lo decide la RAM del equipo.
+ * CÓMO: Un único vector de personas del tamaño del lote se reutiliza: se llena desde el
+ *       origen (generación desde la fila 'desde', snapshot o CSV), se construye su almacén,
+ *       ResultadosLotes combina los parciales y las páginas ya leídas del archivo se
+ *       devuelven al sistema. De cada lote solo se copian las personas que ganaron algo;
+ *       sus textos viven en una arena que dura todo el análisis (crece con los textos
+ *       distintos, no con las filas).
+ * PARA QUÉ: Los mismos reportes que el modo columnar con memoria acotada por el presupuesto.
+ */
+bool analizarPorLotes(const ConfigLotes& config,
+                      const std::function<void(size_t, size_t)>& alTerminarLote,
+                      std::string& error) {
+    ArenaTextos arena;
+    std::unique_ptr<Snapshot> snapshot;
+    std::vector<Texto> textos;
+    std::unique_ptr<LectorCsv> lector;
+    size_t total = config.cantidad;
+    size_t bytesEntrada = 0;   // Bytes del archivo por fila que quedan residentes durante el lote
+    uint64_t primerID = 0;
+
+    if (config.origen == OrigenLotes::Snapshot) {
+        snapshot = Snapshot::abrir(config.ruta, false, error);
+        if (!snapshot) return false;
+        textos = textosDeSnapshot(*snapshot, arena);
+        total = snapshot->filas();
+        bytesEntrada = BYTES_FILA_STORE + 2 * sizeof(uint32_t);
+    } else if (config.origen == OrigenLotes::Csv) {
+        lector = LectorCsv::abrir(config.ruta, error);
+        if (!lector) return false;
+        total = lector->filas();
+        bytesEntrada = (total > 0) ? lector->tamArchivo() / total + 1 : 0;
+    } else {
+        primerID = PRIMER_ID; // Mismos IDs que generarColeccion con la misma semilla
+    }
+
+    size_t porLote = std::min(filasPorLote(config.presupuesto, BYTES_FILA_LOTE + bytesEntrada),
+                              std::max<size_t>(total, 1));
+    ResultadosLotes resultados;
+    std::array<Persona, NUM_GANADORES> ganadores;
+    std::vector<Persona> lote;
+
+    for (size_t desde = 0; desde < total; desde += porLote) {
+        lote.resize(std::min(porLote, total - desde));
+
+        if (snapshot) {
+            llenarDesdeSnapshot(*snapshot, textos, desde, lote);
+            snapshot->liberarFilas(desde, desde + lote.size());
+        } else if (lector) {
+            bool correcto = lector->recorrer(desde, desde + lote.size(),
+                [&](size_t fila, const RegistroCsv& r) { lote[fila - desde] = personaDesdeRegistro(r, arena); },
+                error);
+            if (!correcto) return false;
+            lector->liberarHasta(desde + lote.size());
+        } else if (config.motor == TipoMotor::Mersenne) {
+            llenarColeccion<MotorAleatorio>(lote, desde, primerID, config.semilla, 0);
+        } else {
+            llenarColeccion<MotorXoshiro>(lote, desde, primerID, config.semilla, 0);
+        }
+
+        PersonaStore store = construirStore(lote);
+        resultados.combinarLote(store);
+        for (size_t k = 0; k < NUM_GANADORES; ++k) {
+            if (resultados.ganadorEnUltimoLote(k, lote.size())) ganadores[k] = lote[resultados.analisis.ganadores[k].fila - desde];
+        }
+        if (alTerminarLote) alTerminarLote(resultados.lotes, lote.size());
+    }
+
+    auto ganador = [&](size_t k) -> const Persona* {
+        return (resultados.analisis.ganadores[k].fila == SIN_FILA) ? nullptr : &ganadores[k];
+    };
+    std::cout << "\n=== ANÁLISIS POR LOTES ===\n"
+              << "Personas: " << resultados.filas << " | Lotes: " << resultados.lotes
+              << " | Personas por lote: " << porLote << "\n";
+    imprimirAnalisisCompleto(resultados.analisis, ganador);
+    return true;
+}
+
+/**
+ * Implementación de medirTextos.
+ * 
+ * POR QUÉ: Mostrar en el Monitor la memoria que ahorra la arena de textos.
+ * CÓMO: Un recorrido paralelo suma lo que ocuparía cada nombre y apellido como std::string
+ *       (bytesComoString); la memoria actual es un Texto por campo más la arena del
+ *       conjunto. El catálogo del generador no cuenta: existe una sola vez en el programa,
+ *       lo compartan uno o varios conjuntos.
+ */
+UsoTextos medirTextos(const std::vector<Persona>& personas, const ArenaTextos* textos) {
+    UsoTextos uso = reducirPorBloques(personas.size(), UsoTextos(),
+        [&](UsoTextos& parcial, size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; ++i) {
+                parcial.bytesComoString += bytesComoString(Acceso::nombreDe(personas[i]).size()) +
+                                           bytesComoString(Acceso::apellidoDe(personas[i]).size());
+            }
+        },
+        [](UsoTextos& total, const UsoTextos& parcial) { total.bytesComoString += parcial.bytesComoString; });
+    uso.campos = 2 * personas.size();
+    uso.bytesActuales = uso.campos * sizeof(Texto) + (textos ? textos->memoriaBytes() : 0);
+    return uso;
+}
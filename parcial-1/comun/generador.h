@@ -0,0 +1,515 @@
+#ifndef GENERADOR_H
+#define GENERADOR_H
+
+#include "persona.h"
+#include "analitica.h"
+#include "persona_store.h"
+#include "indice_id.h"
+#include "aleatorio.h"
+#include "buffer_salida.h"
+#include "snapshot.h"
+#include "csv.h"
+#include "lotes.h"
+#include "arena_textos.h"
+#include "agregados.h"
+#include "indice_orden.h"
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// --- Generación, análisis con objetos, colección, snapshot, CSV y lotes de las cuatro variantes ---
+//
+// Como menu.cpp, generador.cpp no se compila una sola vez: cada variante lo compila con su
+// persona.h, que define Persona y las dos políticas de las que depende todo lo de aquí:
+//   AccesoPersona  cómo se lee y se arma una Persona (métodos o campos, analitica.h)
+//   PasoPersona    cómo reciben la colección las opciones 6-8 con objetos (referencia o copia)
+
+/**
+ * Ventana de un listado por grupo.
+ * 
+ * POR QUÉ: Con millones de filas casi nunca se quiere ver el listado completo.
+ * CÓMO: Se muestran las posiciones [desde, desde + cantidad) de cada grupo;
+ *       cantidad = 0 deja solo los conteos.
+ * PARA QUÉ: Listados paginados o de solo conteo sin recorrer de más.
+ */
+const size_t TODAS_LAS_FILAS = static_cast<size_t>(-1);
+struct PaginaListado {
+    size_t desde = 0;                    // Primera posición (0 = inicio del grupo)
+    size_t cantidad = TODAS_LAS_FILAS;   // Filas por grupo (0 = solo conteo)
+};
+
+// Funciones para generación de datos aleatorios
+// Las versiones que no reciben un MotorAleatorio usan un motor compartido sembrado
+// con la hora; solo deben llamarse desde el hilo principal.
+
+/**
+ * Siembra el motor compartido.
+ * 
+ * POR QUÉ: Con la hora como semilla dos ejecuciones nunca usan los mismos datos.
+ * CÓMO: Reiniciando el motor compartido con la semilla dada.
+ * PARA QUÉ: Modo reproducible (--semilla) para comparar las cuatro variantes.
+ */
+void sembrarGenerador(uint64_t semilla);
+
+/**
+ * Genera una fecha de nacimiento aleatoria entre 1960 y 2010.
+ * 
+ * POR QUÉ: Simular fechas realistas para personas.
+ * CÓMO: Combinando números aleatorios para día, mes y año.
+ * PARA QUÉ: Inicializar el atributo fechaNacimiento de Persona.
+ * @param motor MotorAleatorio o MotorXoshiro (instanciados en generador.cpp).
+ * @return Fecha empaquetada como AAAAMMDD (ver fecha.h).
+ */
+template <typename Motor>
+uint32_t generarFechaNacimiento(Motor& motor);
+uint32_t generarFechaNacimiento();
+
+// Primer número de documento generado (las colecciones sembradas siempre parten de él)
+const uint64_t PRIMER_ID = 1000000000;
+
+/**
+ * Genera un ID único secuencial.
+ * 
+ * POR QUÉ: Necesidad de identificadores únicos para cada persona.
+ * CÓMO: Usando un contador estático que incrementa en cada llamada.
+ * PARA QUÉ: Garantizar unicidad en los IDs.
+ * @return Número de documento como entero (se formatea solo al mostrar).
+ */
+uint64_t generarID();
+
+/**
+ * Reserva un rango de IDs consecutivos.
+ * 
+ * POR QUÉ: generarColeccion(n) sin semilla no puede pedir los IDs uno a uno desde varios hilos.
+ * CÓMO: Avanzando el contador de generarID 'cantidad' posiciones.
+ * PARA QUÉ: Repartir de antemano los IDs entre los hilos.
+ * @return Primer ID del rango [primero, primero + cantidad).
+ */
+uint64_t reservarIDs(size_t cantidad);
+
+/**
+ * Genera un número decimal aleatorio en un rango [min, max].
+ * 
+ * POR QUÉ: Necesidad de valores realistas para ingresos, patrimonio, etc.
+ * CÓMO: Usando el motor compartido y una distribución uniforme (decimalAleatorio).
+ * PARA QUÉ: Producir valores financieros aleatorios pero dentro de rangos lógicos.
+ */
+double randomDouble(double min, double max);
+
+/**
+ * Crea una persona con datos aleatorios.
+ * 
+ * POR QUÉ: Automatizar la creación de registros de personas.
+ * CÓMO: Combinando las funciones generadoras y bases de datos de nombres, apellidos, etc.
+ * PARA QUÉ: Poblar el sistema con datos de prueba.
+ * 
+ * @param motor Fuente de todos los valores aleatorios (MotorAleatorio o MotorXoshiro).
+ * @param id Número de documento ya asignado.
+ */
+template <typename Motor>
+Persona generarPersona(Motor& motor, uint64_t id);
+Persona generarPersona();
+
+// Personas por bloque de generación (fijo: de él depende el resultado, no de los hilos)
+const size_t BLOQUE_GENERACION = 16384;
+
+/**
+ * Genera una colección (vector) de n personas en paralelo.
+ * 
+ * POR QUÉ: Crear conjuntos de datos de diferentes tamaños aprovechando todos los núcleos.
+ * CÓMO: Repartiendo bloques de BLOQUE_GENERACION personas entre hilos; cada bloque
+ *       usa su propio motor sembrado con (semilla, número de bloque).
+ * PARA QUÉ: Pruebas de rendimiento y funcionalidad con volúmenes variables.
+ * 
+ * @param semilla Con la misma semilla y motor el resultado es idéntico para cualquier número de hilos;
+ *                los IDs van de PRIMER_ID a PRIMER_ID + n - 1.
+ * @param hilos Hilos a usar (0 = todos los disponibles).
+ * @param tipo Motor de cada bloque (xoshiro256** por defecto, más rápido que mt19937_64).
+ */
+std::vector<Persona> generarColeccion(int n, uint64_t semilla, unsigned hilos = 0,
+                                      TipoMotor tipo = TipoMotor::Xoshiro);
+std::vector<Persona> generarColeccion(int n); // Semilla del motor compartido, IDs de reservarIDs
+
+/**
+ * Busca una persona por ID en un vector de personas.
+ * 
+ * POR QUÉ: Recuperar una persona específica de una colección.
+ * CÓMO: Usando un algoritmo de búsqueda lineal (o binaria si se ordena).
+ * PARA QUÉ: Implementar funcionalidad de búsqueda en la aplicación.
+ * 
+ * @param personas Vector de personas donde buscar.
+ * @param id ID numérico a buscar.
+ * @return Puntero a la persona encontrada o nullptr si no se encuentra.
+ */
+const Persona* buscarPorID(const std::vector<Persona>& personas, uint64_t id);
+
+/**
+ * Determina el grupo DIAN (A/B/C) según los últimos dos dígitos del documento.
+ * 
+ * POR QUÉ: Clasificar contribuyentes según el calendario tributario DIAN 2025.
+ * CÓMO: Evaluando los dos últimos dígitos del ID (id % 100) según rangos establecidos.
+ * PARA QUÉ: Asignar fechas de declaración de renta correspondientes. Se llama una
+ *           sola vez al crear la persona; los análisis usan el grupo precalculado.
+ * 
+ * @param id Número de documento (cédula).
+ * @return Carácter 'A', 'B' o 'C' según la clasificación DIAN.
+ */
+char generarGrupoDIAN(uint64_t id);
+
+/**
+ * Encuentra la persona más longeva (mayor edad) en todo el país.
+ * 
+ * POR QUÉ: Análisis demográfico para identificar la persona de mayor edad.
+ * CÓMO: Comparando la edad precalculada de cada persona (entero, sin parseo).
+ * PARA QUÉ: Reportes estadísticos y análisis poblacional.
+ */
+const Persona* encontrarPersonaMasLongeva(const std::vector<Persona>& personas);
+
+/**
+ * Encuentra las personas más longevas por cada ciudad.
+ * 
+ * POR QUÉ: Análisis demográfico regionalizado.
+ * CÓMO: Agrupando por ciudad y encontrando la mayor edad en cada grupo.
+ * PARA QUÉ: Reportes demográficos por región.
+ */
+void encontrarLongevasPorCiudad(const std::vector<Persona>& personas);
+
+/**
+ * Encuentra la persona con mayor patrimonio en todo el país.
+ * 
+ * POR QUÉ: Análisis económico para identificar la mayor fortuna.
+ * CÓMO: Comparando valores de patrimonio entre todas las personas.
+ * PARA QUÉ: Estudios de distribución de riqueza.
+ */
+const Persona* encontrarMayorPatrimonio(const std::vector<Persona>& personas);
+
+/**
+ * Encuentra las personas con mayor patrimonio por ciudad.
+ * 
+ * POR QUÉ: Análisis económico regionalizado.
+ * CÓMO: Agrupando por ciudad y encontrando el mayor patrimonio en cada grupo.
+ * PARA QUÉ: Estudios de distribución de riqueza por región.
+ */
+void encontrarMayorPatrimonioPorCiudad(const std::vector<Persona>& personas);
+
+/**
+ * Encuentra las personas con mayor patrimonio por grupo DIAN.
+ * 
+ * POR QUÉ: Análisis fiscal por categoría tributaria.
+ * CÓMO: Agrupando por grupo DIAN (A/B/C) y encontrando el mayor patrimonio.
+ * PARA QUÉ: Análisis tributario y distribución de contribuyentes.
+ */
+void encontrarMayorPatrimonioPorGrupoDIAN(const std::vector<Persona>& personas);
+
+/**
+ * Colección que reciben las opciones 6-8 con objetos.
+ * 
+ * POR QUÉ: Las variantes de valor miden el costo de recibir el vector por copia.
+ * CÓMO: PasoPersona (persona.h) decide el tipo del parámetro: const std::vector<Persona>&
+ *       con PasoReferencia, std::vector<Persona> con PasoValor; la copia ocurre en la
+ *       firma, antes de entrar a la función, y el análisis de adentro es el mismo.
+ * PARA QUÉ: Una sola implementación para las cuatro variantes.
+ */
+using ParametroPersonas = PasoPersona::Parametro<std::vector<Persona>>;
+
+/**
+ * Lista y cuenta declarantes de renta por calendario tributario.
+ * 
+ * POR QUÉ: Organización y conteo de obligaciones tributarias.
+ * CÓMO: Clasificando por grupo DIAN y filtrando declarantes.
+ * PARA QUÉ: Administración tributaria y reportes fiscales.
+ */
+void listarDeclarantesPorGrupo(ParametroPersonas personas);
+
+// Misma salida en 'salida', limitada a la ventana 'pagina' de cada grupo
+void listarDeclarantesPorGrupo(const std::vector<Persona>& personas, BufferSalida& salida,
+                               const PaginaListado& pagina);
+
+/**
+ * Analiza ciudades ordenadas por patrimonio promedio más alto.
+ * 
+ * POR QUÉ: Identificar las ciudades con mayor concentración de riqueza.
+ * CÓMO: Calculando el promedio de patrimonio por ciudad y ordenando.
+ * PARA QUÉ: Análisis económico territorial y planificación urbana.
+ */
+void analizarCiudadesPorPatrimonioPromedio(ParametroPersonas personas);
+
+/**
+ * Calcula el porcentaje de personas mayores de 60 años por calendario DIAN.
+ * 
+ * POR QUÉ: Análisis demográfico de población de tercera edad por grupo tributario.
+ * CÓMO: Contando personas >60 años en cada grupo DIAN y calculando porcentajes.
+ * PARA QUÉ: Estudios demográficos y políticas para adultos mayores.
+ */
+void analizarPorcentajeMayores60PorCalendario(ParametroPersonas personas);
+
+// --- Versión columnar (PersonaStore) ---
+
+// --- Colección de personas (vector propio o filas de un snapshot) ---
+
+/**
+ * Personas del conjunto actual, por fila (la fila i del almacén es la persona i).
+ * 
+ * POR QUÉ: Tras cargar un snapshot los análisis columnares corren sobre el archivo mapeado,
+ *          pero imprimir sus ganadores, listar, exportar o editar unas filas obligaba a
+ *          construir el vector completo de personas (26.7 ms y 34 MB con 300k).
+ * CÓMO: Como Columna (persona_store.h), es propia (un std::vector<Persona>) o una vista:
+ *       en la vista, la persona de una fila se arma al pedirla con las columnas del snapshot
+ *       y los textos de su diccionario (Snapshot::cadena, internados una vez en 'textos').
+ *       Solo las filas agregadas o modificadas se guardan aparte; leer nunca guarda nada.
+ * PARA QUÉ: Pagar por persona solo en las filas que se imprimen o editan; el vector
+ *           completo (hacerPropia) solo lo necesitan el modo de objetos y sus benchmarks.
+ */
+class ColeccionPersonas {
+public:
+    explicit ColeccionPersonas(std::vector<Persona> personas = std::vector<Persona>());
+    // Vista sobre 'snapshot'; ambos (snapshot y arena) deben vivir mientras viva la colección
+    ColeccionPersonas(const Snapshot& snapshot, ArenaTextos& textos);
+
+    size_t size() const { return snapshot ? filasVista : propias.size(); }
+    bool empty() const { return size() == 0; }
+    bool esVista() const { return snapshot != nullptr; }
+
+    // Copia de la persona de 'fila'; en la vista no se guarda (segura entre hilos)
+    Persona persona(size_t fila) const;
+    Persona operator[](size_t fila) const { return persona(fila); }
+
+    // Altas, cambios y bajas con la semántica del vector; quitar mueve la última persona a 'fila'
+    void agregar(const Persona& persona);
+    void reemplazar(size_t fila, const Persona& persona);
+    void quitar(size_t fila);
+
+    // Construye el vector completo (en paralelo) y deja de depender del snapshot
+    void hacerPropia();
+
+    // Vector de personas; solo si !esVista()
+    const std::vector<Persona>& objetos() const { return propias; }
+
+private:
+    std::vector<Persona> propias;
+    const Snapshot* snapshot = nullptr;
+    size_t filasVista = 0;
+    std::vector<Texto> textos;                              // Texto de cada cadena del diccionario
+    std::unordered_map<size_t, Persona> armadas;            // Vista: filas agregadas o cambiadas
+};
+
+/**
+ * Construye el almacén columnar alineado con la colección de personas.
+ * 
+ * POR QUÉ: Los análisis solo necesitan unos pocos campos numéricos por persona.
+ * CÓMO: Copiando esos campos (y el ID, para el índice) a arreglos contiguos.
+ * PARA QUÉ: Que los análisis recorran columnas compactas en lugar de objetos completos.
+ * 
+ * @param personas Colección de origen; la fila i del almacén corresponde a personas[i].
+ */
+PersonaStore construirStore(const std::vector<Persona>& personas);
+
+// Las siguientes sobrecargas recorren el almacén; 'personas' se usa solo para imprimir.
+// La colección entrega copias: el ganador se copia en 'copia' y se devuelve &copia (o nullptr).
+const Persona* encontrarPersonaMasLongeva(const ColeccionPersonas& personas, const PersonaStore& store,
+                                          Persona& copia);
+void encontrarLongevasPorCiudad(const ColeccionPersonas& personas, const PersonaStore& store);
+const Persona* encontrarMayorPatrimonio(const ColeccionPersonas& personas, const PersonaStore& store,
+                                        Persona& copia);
+void encontrarMayorPatrimonioPorCiudad(const ColeccionPersonas& personas, const PersonaStore& store);
+void encontrarMayorPatrimonioPorGrupoDIAN(const ColeccionPersonas& personas, const PersonaStore& store);
+void listarDeclarantesPorGrupo(const ColeccionPersonas& personas, const PersonaStore& store);
+void listarDeclarantesPorGrupo(const ColeccionPersonas& personas, const PersonaStore& store,
+                               BufferSalida& salida, const PaginaListado& pagina);
+void analizarCiudadesPorPatrimonioPromedio(const PersonaStore& store);
+void analizarPorcentajeMayores60PorCalendario(const PersonaStore& store);
+
+// --- Distribución de riqueza (seleccion.h) ---
+
+/**
+ * Reporte de distribución de riqueza: los K mayores patrimonios de cada ciudad, los
+ * deciles de patrimonio y la mediana de ingresos por grupo DIAN.
+ * 
+ * POR QUÉ: Más allá del máximo por ciudad, estas preguntas exigían ordenar todo el conjunto.
+ * CÓMO: Una pasada paralela con un montículo acotado a K por ciudad; los percentiles
+ *       exactos con nth_element por grupo, o aproximados con bocetos de cuantiles.
+ * PARA QUÉ: Top-K y cuantiles en tiempo lineal, junto a los análisis de las opciones 5 y 7.
+ * 
+ * @param aproximado Percentiles con BocetoCuantiles (error relativo <= 1%, sin copiar valores).
+ */
+void analizarDistribucionRiqueza(const std::vector<Persona>& personas, size_t k, bool aproximado);
+void analizarDistribucionRiqueza(const ColeccionPersonas& personas, const PersonaStore& store,
+                                 size_t k, bool aproximado);
+
+// --- Búsqueda indexada (IndiceID) ---
+
+/**
+ * Busca una persona por ID usando el índice.
+ * 
+ * POR QUÉ: La búsqueda lineal recorre toda la colección.
+ * CÓMO: El índice traduce el ID a la fila en O(1) (desplazamiento o tabla hash).
+ * PARA QUÉ: Búsquedas en microsegundos sobre millones de registros.
+ * 
+ * @param indice Índice construido sobre los IDs de 'personas' (fila i = personas[i]).
+ * @param copia Recibe la persona encontrada (la colección entrega copias).
+ * @return &copia, o nullptr si no se encuentra.
+ */
+const Persona* buscarPorID(const ColeccionPersonas& personas, const IndiceID& indice, uint64_t id,
+                           Persona& copia);
+
+/**
+ * Busca varios IDs en una sola llamada.
+ * 
+ * POR QUÉ: Resolver lotes de IDs sin pagar una llamada y un fallo de caché por cada uno.
+ * CÓMO: Usando IndiceID::buscarLote, que precarga las ranuras de la tabla por bloques.
+ * PARA QUÉ: Consultas masivas (cruces de listas de documentos).
+ * 
+ * @return La fila de cada ID, en el mismo orden (SIN_FILA si no existe); la persona se
+ *         pide a la colección solo para las filas que se usan.
+ */
+std::vector<size_t> buscarPorIDs(const IndiceID& indice, const std::vector<uint64_t>& ids);
+
+// --- Snapshot binario (snapshot.h) ---
+
+/**
+ * Guarda la población en un snapshot.
+ * 
+ * POR QUÉ: Poder reabrir el mismo conjunto en otra sesión sin regenerarlo.
+ * CÓMO: Toma las columnas numéricas del almacén y arma el diccionario de nombres y
+ *       apellidos (cada texto distinto una sola vez) con las columnas de índices y fechas.
+ * @return false (con el motivo en 'error') si no se pudo escribir.
+ */
+bool guardarSnapshot(const std::string& ruta, const ColeccionPersonas& personas,
+                     const PersonaStore& store, std::string& error);
+
+// --- CSV (csv.h) ---
+
+/**
+ * Escribe todas las personas en formato CSV (con la línea de cabecera).
+ * 
+ * POR QUÉ: Llevar el conjunto a hojas de cálculo, bases de datos u otros programas.
+ * CÓMO: Cada persona se convierte en un RegistroCsv que apunta a sus textos (sin copiarlos)
+ *       y se escribe en el BufferSalida (archivo, FIFO o pipe).
+ */
+void exportarCsv(const ColeccionPersonas& personas, BufferSalida& salida);
+
+/**
+ * Lee un archivo CSV de personas (ver formato en csv.h).
+ * 
+ * POR QUÉ: Trabajar con extractos reales en lugar de datos generados.
+ * CÓMO: LectorCsv cuenta las filas, el vector se dimensiona una vez y los trozos del
+ *       archivo se analizan en paralelo, cada uno escribiendo en sus propias posiciones.
+ *       El grupo DIAN, el año y la edad se calculan como al generar; nombres y apellidos
+ *       se internan en 'textos', que debe vivir mientras vivan las personas.
+ * @return false (con "línea N: motivo" en 'error') si el archivo no se pudo leer o repite un ID.
+ */
+bool importarCsv(const std::string& ruta, std::vector<Persona>& personas, ArenaTextos& textos,
+                 std::string& error);
+
+// --- Todos los análisis en una pasada ---
+
+/**
+ * Imprime longevidad, patrimonio, conteo de declarantes, promedio por ciudad y mayores
+ * de 60 (opciones 4-8) calculados en una sola pasada sobre el almacén.
+ * 
+ * POR QUÉ: Cada opción por separado vuelve a recorrer el conjunto.
+ * CÓMO: analisisCompleto (persona_store.h) acumula todo a la vez, en paralelo por bloques.
+ * PARA QUÉ: El reporte completo en el tiempo de un recorrido de memoria.
+ * 
+ * @param store Almacén columnar construido a partir de 'personas' (mismo orden).
+ */
+void analizarTodo(const ColeccionPersonas& personas, const PersonaStore& store);
+
+/**
+ * Imprime los mismos análisis a partir de los agregados mantenidos (agregados.h).
+ * 
+ * POR QUÉ: Tras una alta, un cambio o una baja no hace falta recorrer el conjunto.
+ * CÓMO: AgregadosPersonas::consultar; solo recorre el almacén si hay ganadores por recalcular.
+ */
+void mostrarAgregados(const ColeccionPersonas& personas, const PersonaStore& store,
+                      AgregadosPersonas& agregados);
+
+// --- Altas, cambios y bajas (agregados.h) ---
+
+/**
+ * Agrega una persona al final del conjunto.
+ * 
+ * POR QUÉ: El conjunto solo se podía generar o cargar completo.
+ * CÓMO: Construye la persona desde 'datos' (textos internados en 'textos') y la agrega
+ *       a la colección, al almacén, al índice de IDs y a los agregados.
+ * PARA QUÉ: Altas en O(1) que dejan todas las estructuras al día.
+ * @return false (con el motivo en 'error') si el ID ya existe.
+ */
+bool agregarPersona(const RegistroCsv& datos, ColeccionPersonas& personas, ArenaTextos& textos,
+                    PersonaStore& store, IndiceID& indice, AgregadosPersonas& agregados, std::string& error);
+
+/**
+ * Reemplaza los datos de la persona con el ID de 'datos' (el ID no cambia).
+ * 
+ * CÓMO: Misma fila en la colección y el almacén; los agregados restan los valores
+ *       anteriores y suman los nuevos.
+ * @return false (con el motivo en 'error') si el ID no existe.
+ */
+bool modificarPersona(const RegistroCsv& datos, ColeccionPersonas& personas, ArenaTextos& textos,
+                      PersonaStore& store, const IndiceID& indice, AgregadosPersonas& agregados,
+                      std::string& error);
+
+/**
+ * Elimina la persona con el ID indicado.
+ * 
+ * CÓMO: La última persona pasa a ocupar su fila (O(1), sin desplazar el resto), y el
+ *       índice y los agregados se actualizan con el cambio de fila.
+ * @return false (con el motivo en 'error') si el ID no existe.
+ */
+bool eliminarPersona(uint64_t id, ColeccionPersonas& personas, PersonaStore& store, IndiceID& indice,
+                     AgregadosPersonas& agregados, std::string& error);
+
+// --- Índices ordenados (indice_orden.h) ---
+
+/**
+ * Construye el índice ordenado de un campo (en paralelo).
+ * 
+ * POR QUÉ: Los K mayores, percentiles y rangos por valor necesitaban recorrer todo.
+ * CÓMO: Patrimonio, ingresos y deudas salen de las columnas del almacén; la fecha de
+ *       nacimiento, de las personas. Es una foto: se reconstruye si el conjunto cambia.
+ */
+IndiceOrden construirIndiceOrden(const ColeccionPersonas& personas, const PersonaStore& store, CampoOrden campo);
+
+/**
+ * Responde e imprime una consulta sobre un índice ordenado.
+ * 
+ * CÓMO: K mayores o menores, percentil o rango [desde, hasta] (conteo y primeras
+ *       consulta.cantidad personas), de todas las ciudades o de consulta.ciudad.
+ * PARA QUÉ: Consultas de orden en tiempo logarítmico sin recorrer el conjunto.
+ */
+void consultarIndiceOrden(const ColeccionPersonas& personas, const IndiceOrden& indice, CampoOrden campo,
+                          const ConsultaOrden& consulta);
+
+// --- Procesamiento por lotes (lotes.h) ---
+
+/**
+ * Analiza un conjunto que no cabe en memoria, por lotes de tamaño fijo.
+ * 
+ * POR QUÉ: Los demás análisis necesitan el vector completo de personas.
+ * CÓMO: Genera (desde la semilla) o lee (snapshot o CSV) un lote a la vez, lo combina
+ *       en ResultadosLotes y lo descarta; el tamaño del lote sale de config.presupuesto.
+ *       Al final imprime longevidad, patrimonio, conteo de declarantes, promedio por
+ *       ciudad y mayores de 60 (mismos resultados que el modo columnar con el conjunto completo).
+ * PARA QUÉ: Trabajar con decenas de millones de registros con la memoria acotada.
+ * 
+ * @param alTerminarLote Se llama tras cada lote con (número de lote, personas del lote).
+ * @return false (con el motivo en 'error') si el origen no se pudo leer.
+ */
+bool analizarPorLotes(const ConfigLotes& config,
+                      const std::function<void(size_t, size_t)>& alTerminarLote,
+                      std::string& error);
+
+// --- Textos en arena (arena_textos.h) ---
+
+/**
+ * Mide la memoria de nombres y apellidos frente a guardarlos en un std::string por campo.
+ * 
+ * POR QUÉ: Informar en el Monitor cuánto ahorra la arena de textos.
+ * @param textos Arena de las personas (nullptr = generadas: sus textos están en el
+ *               catálogo del generador, compartido por todos los conjuntos, y no se
+ *               cuentan como memoria del conjunto).
+ */
+UsoTextos medirTextos(const std::vector<Persona>& personas, const ArenaTextos* textos);
+
+#endif // GENERADOR_H
\ No newline at end of file
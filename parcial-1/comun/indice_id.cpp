@@ -0,0 +1,188 @@
+#include "indice_id.h"
+
+/**
+ * Mezcla de bits de splitmix64.
+ *
+ * POR QUÉ: Los IDs casi consecutivos caerían en ranuras contiguas con una máscara directa.
+ * CÓMO: Multiplicaciones y desplazamientos que reparten todos los bits de entrada.
+ */
+static inline uint64_t mezclar(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+size_t IndiceID::posicion(uint64_t id) const {
+    return static_cast<size_t>(mezclar(id)) & mascara;
+}
+
+void IndiceID::construir(const uint64_t* ids, size_t filas) {
+    base = (filas == 0) ? 0 : ids[0];
+    std::vector<Ranura>().swap(tabla); // Libera la tabla de una construcción anterior
+    mascara = 0;
+
+    // Caso denso: ids[i] == base + i para toda fila
+    denso = true;
+    for (size_t i = 0; i < filas; ++i) {
+        if (ids[i] != base + i) { denso = false; break; }
+    }
+    if (denso) {
+        cantidad = filas;
+        return;
+    }
+
+    // Caso general: capacidad potencia de 2 con al menos el doble de entradas
+    size_t capacidad = 16;
+    while (capacidad < 2 * filas) capacidad <<= 1;
+    tabla.assign(capacidad, Ranura{0, SIN_FILA});
+    mascara = capacidad - 1;
+
+    cantidad = 0;
+    for (size_t i = 0; i < filas; ++i) {
+        size_t pos = posicion(ids[i]);
+        while (tabla[pos].fila != SIN_FILA && tabla[pos].id != ids[i]) {
+            pos = (pos + 1) & mascara;
+        }
+        if (tabla[pos].fila == SIN_FILA) { // Conserva la primera fila de un ID repetido
+            tabla[pos] = Ranura{ids[i], i};
+            ++cantidad;
+        }
+    }
+}
+
+size_t IndiceID::buscar(uint64_t id) const {
+    if (denso) {
+        // La resta sin signo convierte los IDs menores que base en valores enormes
+        uint64_t desplazamiento = id - base;
+        return (desplazamiento < cantidad) ? static_cast<size_t>(desplazamiento) : SIN_FILA;
+    }
+
+    size_t pos = posicion(id);
+    while (tabla[pos].fila != SIN_FILA) {
+        if (tabla[pos].id == id) return tabla[pos].fila;
+        pos = (pos + 1) & mascara;
+    }
+    return SIN_FILA;
+}
+
+void IndiceID::buscarLote(const std::vector<uint64_t>& ids, std::vector<size_t>& filas) const {
+    filas.resize(ids.size());
+
+    if (denso) {
+        for (size_t i = 0; i < ids.size(); ++i) filas[i] = buscar(ids[i]);
+        return;
+    }
+
+    const size_t BLOQUE = 16; // IDs cuyas ranuras se precargan a la vez
+    size_t posiciones[BLOQUE];
+
+    for (size_t inicio = 0; inicio < ids.size(); inicio += BLOQUE) {
+        size_t fin = (inicio + BLOQUE < ids.size()) ? inicio + BLOQUE : ids.size();
+
+        // Fase 1: calcular posiciones y pedir las líneas de caché
+        for (size_t i = inicio; i < fin; ++i) {
+            posiciones[i - inicio] = posicion(ids[i]);
+            __builtin_prefetch(&tabla[posiciones[i - inicio]]);
+        }
+
+        // Fase 2: sondear (las ranuras ya vienen en camino a la caché)
+        for (size_t i = inicio; i < fin; ++i) {
+            size_t pos = posiciones[i - inicio];
+            size_t fila = SIN_FILA;
+            while (tabla[pos].fila != SIN_FILA) {
+                if (tabla[pos].id == ids[i]) { fila = tabla[pos].fila; break; }
+                pos = (pos + 1) & mascara;
+            }
+            filas[i] = fila;
+        }
+    }
+}
+
+size_t IndiceID::ranura(uint64_t id) const {
+    size_t pos = posicion(id);
+    while (tabla[pos].fila != SIN_FILA) {
+        if (tabla[pos].id == id) return pos;
+        pos = (pos + 1) & mascara;
+    }
+    return SIN_FILA;
+}
+
+void IndiceID::redimensionar(size_t entradas) {
+    size_t capacidad = 16;
+    while (capacidad < 2 * entradas) capacidad <<= 1;
+    std::vector<Ranura> anterior(capacidad, Ranura{0, SIN_FILA});
+    anterior.swap(tabla);
+    mascara = capacidad - 1;
+
+    for (const Ranura& r : anterior) {
+        if (r.fila == SIN_FILA) continue;
+        size_t pos = posicion(r.id);
+        while (tabla[pos].fila != SIN_FILA) pos = (pos + 1) & mascara;
+        tabla[pos] = r;
+    }
+}
+
+void IndiceID::pasarAHash() {
+    denso = false;
+    redimensionar(cantidad + 1);
+    for (size_t i = 0; i < cantidad; ++i) {
+        size_t pos = posicion(base + i);
+        while (tabla[pos].fila != SIN_FILA) pos = (pos + 1) & mascara;
+        tabla[pos] = Ranura{base + i, i};
+    }
+}
+
+void IndiceID::agregar(uint64_t id, size_t fila) {
+    if (denso) {
+        if (cantidad == 0 && fila == 0) base = id;
+        if (fila == cantidad && id == base + cantidad) {
+            ++cantidad;
+            return;
+        }
+        pasarAHash();
+    }
+
+    if ((cantidad + 1) * 2 > tabla.size()) redimensionar(cantidad + 1);
+    size_t pos = posicion(id);
+    while (tabla[pos].fila != SIN_FILA && tabla[pos].id != id) pos = (pos + 1) & mascara;
+    if (tabla[pos].fila == SIN_FILA) ++cantidad;
+    tabla[pos] = Ranura{id, fila};
+}
+
+void IndiceID::quitar(uint64_t id) {
+    if (denso) {
+        if (buscar(id) == SIN_FILA) return;
+        if (id == base + cantidad - 1) {  // La última fila: la secuencia sigue completa
+            --cantidad;
+            return;
+        }
+        pasarAHash();
+    }
+
+    size_t hueco = ranura(id);
+    if (hueco == SIN_FILA) return;
+    tabla[hueco].fila = SIN_FILA;
+    --cantidad;
+
+    // Una entrada puede ocupar el hueco si su posición ideal no está entre el hueco y ella
+    for (size_t pos = (hueco + 1) & mascara; tabla[pos].fila != SIN_FILA; pos = (pos + 1) & mascara) {
+        size_t ideal = posicion(tabla[pos].id);
+        if (((pos - ideal) & mascara) >= ((pos - hueco) & mascara)) {
+            tabla[hueco] = tabla[pos];
+            tabla[pos].fila = SIN_FILA;
+            hueco = pos;
+        }
+    }
+}
+
+void IndiceID::reubicar(uint64_t id, size_t fila) {
+    if (denso) {
+        if (buscar(id) == fila) return;
+        pasarAHash();
+    }
+    size_t pos = ranura(id);
+    if (pos != SIN_FILA) tabla[pos].fila = fila;
+}
@@ -0,0 +1,96 @@
+#ifndef INDICE_ID_H
+#define INDICE_ID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "persona_store.h" // SIN_FILA
+
+/**
+ * Índice de IDs a filas para búsquedas en O(1).
+ *
+ * POR QUÉ: buscarPorID recorre la colección completa (2M comparaciones en el peor caso).
+ * CÓMO: Si los IDs son consecutivos (como los entrega generarID) la fila se calcula
+ *       como id - base; si no, se usa una tabla hash de direccionamiento abierto
+ *       (sondeo lineal, capacidad potencia de 2, factor de carga <= 0.5).
+ * PARA QUÉ: Que la opción 3 tome microsegundos y permitir búsquedas por lotes.
+ */
+struct IndiceID {
+    /**
+     * Construye el índice a partir de la columna de IDs (fila i = ids[i], i < filas).
+     *
+     * POR QUÉ: Pagar el costo de indexar una sola vez, junto con la generación.
+     * CÓMO: Detecta primero el caso denso; solo si falla llena la tabla hash.
+     *       Ante IDs repetidos se conserva la primera fila, como la búsqueda lineal, y
+     *       size() cuenta solo los IDs distintos (menor que 'filas' si hubo repetidos).
+     */
+    void construir(const uint64_t* ids, size_t filas);
+
+    // Fila del ID, o SIN_FILA si no existe
+    size_t buscar(uint64_t id) const;
+
+    /**
+     * Busca varios IDs a la vez.
+     *
+     * POR QUÉ: En la tabla hash cada búsqueda suele fallar en caché.
+     * CÓMO: Procesa bloques de IDs: primero calcula sus posiciones y las precarga
+     *       (__builtin_prefetch), luego sondea; así los accesos a memoria se solapan.
+     * PARA QUÉ: Resolver muchos IDs con mejor rendimiento que llamadas sueltas.
+     *
+     * @param filas Recibe una fila (o SIN_FILA) por cada ID, en el mismo orden.
+     */
+    void buscarLote(const std::vector<uint64_t>& ids, std::vector<size_t>& filas) const;
+
+    // --- Actualización tras altas, cambios y bajas (IDs únicos) ---
+
+    /**
+     * Agrega el ID de una fila nueva.
+     *
+     * CÓMO: Si continúa la secuencia (id = base + cantidad en la fila cantidad) el índice
+     *       sigue denso; si no, pasa a la tabla hash, que crece al superar la carga 0.5.
+     */
+    void agregar(uint64_t id, size_t fila);
+
+    /**
+     * Quita un ID (sin efecto si no está).
+     *
+     * CÓMO: En la tabla hash, borrado con desplazamiento hacia atrás: las entradas
+     *       siguientes del mismo tramo se corren al hueco, así que no quedan lápidas.
+     */
+    void quitar(uint64_t id);
+
+    // Cambia la fila de un ID existente (p. ej. la última fila movida por una baja)
+    void reubicar(uint64_t id, size_t fila);
+
+    bool esDenso() const { return denso; }
+    size_t size() const { return cantidad; }
+
+    // Memoria usada por el índice en bytes (0 en el caso denso)
+    size_t memoriaBytes() const { return tabla.capacity() * sizeof(Ranura); }
+
+private:
+    // Entrada de la tabla hash; fila == SIN_FILA marca una ranura vacía
+    struct Ranura {
+        uint64_t id;
+        size_t fila;
+    };
+
+    size_t posicion(uint64_t id) const;
+
+    // Ranura del ID en la tabla hash, o SIN_FILA si no está
+    size_t ranura(uint64_t id) const;
+
+    // Crea una tabla con capacidad para 'entradas' y mueve a ella las entradas actuales
+    void redimensionar(size_t entradas);
+
+    // Convierte el caso denso en tabla hash (una alta o baja rompió la secuencia)
+    void pasarAHash();
+
+    bool denso = true;       // IDs consecutivos: fila = id - base
+    uint64_t base = 0;       // Primer ID (caso denso)
+    size_t cantidad = 0;     // Filas indexadas
+    std::vector<Ranura> tabla;  // Tabla hash (solo si no es denso)
+    size_t mascara = 0;      // capacidad - 1
+};
+
+#endif // INDICE_ID_H
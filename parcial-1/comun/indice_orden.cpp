@@ -0,0 +1,184 @@
+#include "indice_orden.h"
+#include "paralelo.h" // paraCadaBloque
+#include "perfilador.h" // Fase
+#include "seleccion.h" // posicionPercentil
+#include <algorithm>  // std::sort, std::merge, std::lower_bound
+
+// Pares por bloque en el ordenamiento inicial (cada uno se ordena en un hilo)
+static const size_t BLOQUE_ORDEN = 65536;
+
+// Clave y fila; el orden (clave, fila) es total, así que el resultado es único
+struct ClaveFila {
+    double clave;
+    uint32_t fila;
+};
+
+static inline bool antes(const ClaveFila& a, const ClaveFila& b) {
+    return a.clave < b.clave || (a.clave == b.clave && a.fila < b.fila);
+}
+
+void IndiceOrden::construir(const double* valores, const CiudadId* ciudadesFila, size_t cantidad, unsigned hilos) {
+    Fase fase("índice ordenado");
+    std::vector<ClaveFila> pares(cantidad);
+    {
+        Fase faseOrden("ordenar bloques");
+        paraCadaBloque(cantidad, BLOQUE_ORDEN, hilos, [&](size_t, size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; ++i) pares[i] = ClaveFila{valores[i], static_cast<uint32_t>(i)};
+            std::sort(pares.begin() + inicio, pares.begin() + fin, antes);
+        });
+    }
+
+    // Mezcla por rondas: tramos ordenados de 'ancho' pares se combinan de a dos
+    {
+        Fase faseMezcla("mezclar");
+        std::vector<ClaveFila> mezcla(cantidad);
+        for (size_t ancho = BLOQUE_ORDEN; ancho < cantidad; ancho *= 2) {
+            size_t parejas = (cantidad + 2 * ancho - 1) / (2 * ancho);
+            paraCadaBloque(parejas, 1, hilos, [&](size_t pareja, size_t, size_t) {
+                size_t inicio = pareja * 2 * ancho;
+                size_t medio = std::min(inicio + ancho, cantidad);
+                size_t fin = std::min(inicio + 2 * ancho, cantidad);
+                std::merge(pares.begin() + inicio, pares.begin() + medio, pares.begin() + medio,
+                           pares.begin() + fin, mezcla.begin() + inicio, antes);
+            });
+            pares.swap(mezcla);
+        }
+    }
+
+    claves.resize(cantidad);
+    filas.resize(cantidad);
+    ciudades.resize(cantidad);
+    size_t numMuestras = (cantidad + MUESTREO - 1) / MUESTREO + 1;  // Incluye la del final (pos = cantidad)
+    muestras.assign(numMuestras * NUM_CIUDADES, 0);
+    Fase faseColumnas("columnas y muestras");
+
+    // Columnas en orden y conteo por ciudad de cada tramo de MUESTREO posiciones (en la
+    // muestra siguiente; la suma acumulada va después). BLOQUE_ORDEN es múltiplo de
+    // MUESTREO, así que cada tramo lo cuenta un solo hilo
+    paraCadaBloque(cantidad, BLOQUE_ORDEN, hilos, [&](size_t, size_t inicio, size_t fin) {
+        for (size_t pos = inicio; pos < fin; ++pos) {
+            claves[pos] = pares[pos].clave;
+            filas[pos] = pares[pos].fila;
+            CiudadId c = ciudadesFila[pares[pos].fila];
+            ciudades[pos] = c;
+            muestras[(pos / MUESTREO + 1) * NUM_CIUDADES + c]++;
+        }
+    });
+    for (size_t m = 1; m < numMuestras; ++m) {
+        for (size_t c = 0; c < NUM_CIUDADES; ++c) {
+            muestras[m * NUM_CIUDADES + c] += muestras[(m - 1) * NUM_CIUDADES + c];
+        }
+    }
+}
+
+size_t IndiceOrden::memoriaBytes() const {
+    return claves.capacity() * sizeof(double) + filas.capacity() * sizeof(uint32_t) +
+           ciudades.capacity() * sizeof(CiudadId) + muestras.capacity() * sizeof(uint32_t);
+}
+
+size_t IndiceOrden::cota(double valor, bool estricto) const {
+    auto it = estricto ? std::upper_bound(claves.begin(), claves.end(), valor)
+                       : std::lower_bound(claves.begin(), claves.end(), valor);
+    return static_cast<size_t>(it - claves.begin());
+}
+
+size_t IndiceOrden::contarAntes(CiudadId ciudad, size_t pos) const {
+    if (ciudad == CIUDAD_INVALIDA) return pos;
+    size_t m = pos / MUESTREO;
+    size_t cantidad = muestras[m * NUM_CIUDADES + ciudad];
+    for (size_t i = m * MUESTREO; i < pos; ++i) cantidad += (ciudades[i] == ciudad);
+    return cantidad;
+}
+
+/**
+ * Implementación de posicionDe.
+ *
+ * CÓMO: Búsqueda binaria de la última muestra con a lo sumo k filas de la ciudad antes
+ *       de ella; desde ahí, recorrido de su tramo hasta la k-ésima.
+ */
+size_t IndiceOrden::posicionDe(CiudadId ciudad, size_t k) const {
+    if (ciudad == CIUDAD_INVALIDA) return k;
+    size_t bajo = 0;
+    size_t alto = muestras.size() / NUM_CIUDADES;
+    while (alto - bajo > 1) {
+        size_t medio = (bajo + alto) / 2;
+        if (muestras[medio * NUM_CIUDADES + ciudad] <= k) bajo = medio;
+        else alto = medio;
+    }
+    size_t cantidad = muestras[bajo * NUM_CIUDADES + ciudad];
+    for (size_t pos = bajo * MUESTREO; pos < ciudades.size(); ++pos) {
+        if (ciudades[pos] != ciudad) continue;
+        if (cantidad == k) return pos;
+        ++cantidad;
+    }
+    return ciudades.size();
+}
+
+size_t IndiceOrden::total(CiudadId ciudad) const {
+    return contarAntes(ciudad, size());
+}
+
+size_t IndiceOrden::contar(double desde, double hasta, CiudadId ciudad) const {
+    size_t inicio = cota(desde, false);
+    size_t fin = cota(hasta, true);
+    if (fin <= inicio) return 0;
+    return contarAntes(ciudad, fin) - contarAntes(ciudad, inicio);
+}
+
+std::vector<size_t> IndiceOrden::filasEnRango(double desde, double hasta, CiudadId ciudad, size_t maximo) const {
+    std::vector<size_t> resultado;
+    size_t inicio = cota(desde, false);
+    size_t fin = cota(hasta, true);
+    if (fin <= inicio) return resultado;
+    for (size_t k = contarAntes(ciudad, inicio); resultado.size() < maximo; ++k) {
+        size_t pos = posicionDe(ciudad, k);
+        if (pos >= fin) break;
+        resultado.push_back(filas[pos]);
+    }
+    return resultado;
+}
+
+std::vector<size_t> IndiceOrden::menores(size_t k, CiudadId ciudad) const {
+    std::vector<size_t> resultado;
+    size_t disponibles = std::min(k, total(ciudad));
+    for (size_t j = 0; j < disponibles; ++j) resultado.push_back(filas[posicionDe(ciudad, j)]);
+    return resultado;
+}
+
+/**
+ * Implementación de mayores.
+ *
+ * CÓMO: Desde el final, por tramos de clave igual: se ubica la última fila de la ciudad,
+ *       el comienzo de su tramo de clave (búsqueda binaria) y se entregan las filas de la
+ *       ciudad de ese tramo en orden ascendente (la fila anterior gana el empate).
+ */
+std::vector<size_t> IndiceOrden::mayores(size_t k, CiudadId ciudad) const {
+    std::vector<size_t> resultado;
+    size_t restantes = total(ciudad);  // Filas de la ciudad aún no entregadas (las primeras)
+    while (resultado.size() < k && restantes > 0) {
+        size_t ultima = posicionDe(ciudad, restantes - 1);
+        size_t primera = contarAntes(ciudad, cota(claves[ultima], false));
+        for (size_t j = primera; j < restantes && resultado.size() < k; ++j) {
+            resultado.push_back(filas[posicionDe(ciudad, j)]);
+        }
+        restantes = primera;
+    }
+    return resultado;
+}
+
+bool IndiceOrden::percentil(double p, CiudadId ciudad, double& valor) const {
+    size_t cantidad = total(ciudad);
+    if (cantidad == 0 || p < 0 || p > 100) return false;
+    valor = claves[posicionDe(ciudad, posicionPercentil(p, cantidad))];
+    return true;
+}
+
+const char* nombreCampoOrden(CampoOrden campo) {
+    switch (campo) {
+        case CampoOrden::Patrimonio: return "Patrimonio";
+        case CampoOrden::Ingresos: return "Ingresos anuales";
+        case CampoOrden::Deudas: return "Deudas";
+        case CampoOrden::FechaNacimiento: return "Fecha de nacimiento";
+    }
+    return "";
+}
@@ -0,0 +1,109 @@
+#ifndef INDICE_ORDEN_H
+#define INDICE_ORDEN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ciudades.h"
+
+/**
+ * Índice secundario ordenado sobre una columna (permutación de filas por valor).
+ *
+ * POR QUÉ: Los K mayores, un percentil o "patrimonio entre X e Y en Cali" solo se podían
+ *          responder recorriendo todas las filas.
+ * CÓMO: Las filas ordenadas por (clave, fila), con la clave y la ciudad de cada posición
+ *       copiadas en el mismo orden. Un rango de claves es una búsqueda binaria. Para filtrar
+ *       por ciudad sin recorrer el rango, cada MUESTREO posiciones se guarda cuántas filas de
+ *       cada ciudad hay antes (rank); contar las de una ciudad en un tramo es restar dos rank
+ *       y ubicar la k-ésima de una ciudad (select) es una búsqueda binaria en las muestras
+ *       más un recorrido de a lo sumo MUESTREO posiciones.
+ * PARA QUÉ: Consultas de orden en tiempo logarítmico, con o sin ciudad.
+ *
+ * El índice es una foto del almacén: se reconstruye si el conjunto cambia.
+ */
+class IndiceOrden {
+public:
+    // Posiciones entre muestras de conteo por ciudad
+    static const size_t MUESTREO = 64;
+
+    /**
+     * Construye el índice en paralelo.
+     *
+     * CÓMO: Cada bloque de pares (clave, fila) se ordena en un hilo y los bloques se mezclan
+     *       de a pares por rondas (std::merge), también en paralelo. El orden es total
+     *       (la fila desempata), así que no depende del número de hilos.
+     *
+     * @param claves Valor de cada fila (i < filas).
+     * @param ciudades Ciudad de cada fila.
+     */
+    void construir(const double* claves, const CiudadId* ciudades, size_t filas, unsigned hilos = 0);
+
+    size_t size() const { return filas.size(); }
+    bool empty() const { return filas.empty(); }
+
+    // Memoria del índice en bytes
+    size_t memoriaBytes() const;
+
+    // Fila y clave en la posición 'pos' del orden ascendente
+    size_t fila(size_t pos) const { return filas[pos]; }
+    double clave(size_t pos) const { return claves[pos]; }
+
+    // Filas con clave en [desde, hasta] (ciudad = CIUDAD_INVALIDA: todas las ciudades)
+    size_t contar(double desde, double hasta, CiudadId ciudad = CIUDAD_INVALIDA) const;
+
+    // Hasta 'maximo' filas con clave en [desde, hasta], de menor a mayor clave
+    std::vector<size_t> filasEnRango(double desde, double hasta, CiudadId ciudad, size_t maximo) const;
+
+    // Las 'k' filas de menor clave (en empate, la fila anterior primero)
+    std::vector<size_t> menores(size_t k, CiudadId ciudad = CIUDAD_INVALIDA) const;
+
+    // Las 'k' filas de mayor clave (en empate, la fila anterior primero, como encontrarMayorPatrimonio)
+    std::vector<size_t> mayores(size_t k, CiudadId ciudad = CIUDAD_INVALIDA) const;
+
+    /**
+     * Percentil por rango más cercano: la menor clave con al menos p% de las filas <= ella.
+     *
+     * @return false si no hay filas (de la ciudad) o p está fuera de [0, 100].
+     */
+    bool percentil(double p, CiudadId ciudad, double& valor) const;
+
+private:
+    // Primera posición con clave >= valor (o > valor si 'estricto')
+    size_t cota(double valor, bool estricto) const;
+
+    // Filas de la ciudad en las posiciones [0, pos) (rank)
+    size_t contarAntes(CiudadId ciudad, size_t pos) const;
+
+    // Posición de la k-ésima fila (desde 0) de la ciudad en el orden (select)
+    size_t posicionDe(CiudadId ciudad, size_t k) const;
+
+    // Total de filas de la ciudad (o todas con CIUDAD_INVALIDA)
+    size_t total(CiudadId ciudad) const;
+
+    std::vector<double> claves;        // Claves en orden ascendente
+    std::vector<uint32_t> filas;       // Fila de cada posición
+    std::vector<CiudadId> ciudades;    // Ciudad de cada posición
+    std::vector<uint32_t> muestras;    // [m * NUM_CIUDADES + c]: filas de c antes de m * MUESTREO
+};
+
+// Columnas con índice ordenado
+enum class CampoOrden { Patrimonio, Ingresos, Deudas, FechaNacimiento };
+const size_t NUM_CAMPOS_ORDEN = 4;
+
+// Nombre del campo para menús y reportes
+const char* nombreCampoOrden(CampoOrden campo);
+
+// Consultas que responde un IndiceOrden
+enum class TipoConsultaOrden { Mayores, Menores, Percentil, Rango };
+
+// Parámetros de una consulta (ciudad = CIUDAD_INVALIDA: todas)
+struct ConsultaOrden {
+    TipoConsultaOrden tipo = TipoConsultaOrden::Mayores;
+    size_t cantidad = 10;      // K de Mayores/Menores; máximo de filas listadas en Rango
+    double percentil = 50;     // Percentil
+    double desde = 0;          // Rango [desde, hasta]
+    double hasta = 0;
+    CiudadId ciudad = CIUDAD_INVALIDA;
+};
+
+#endif // INDICE_ORDEN_H
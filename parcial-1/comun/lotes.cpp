@@ -0,0 +1,13 @@
+#include "lotes.h"
+#include "paralelo.h" // BLOQUE_REDUCCION
+
+size_t filasPorLote(size_t presupuestoBytes, size_t bytesPorFila) {
+    size_t bloques = presupuestoBytes / (bytesPorFila * BLOQUE_REDUCCION);
+    return (bloques > 0 ? bloques : 1) * BLOQUE_REDUCCION;
+}
+
+void ResultadosLotes::combinarLote(const PersonaStore& lote) {
+    acumularAnalisisCompleto(lote, analisis, filas);
+    filas += lote.size();
+    ++lotes;
+}
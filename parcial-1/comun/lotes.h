@@ -0,0 +1,74 @@
+#ifndef LOTES_H
+#define LOTES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "aleatorio.h"
+#include "ciudades.h"
+#include "persona_store.h"
+
+/**
+ * Procesamiento por lotes (fuera de memoria).
+ *
+ * POR QUÉ: Todos los análisis reciben el std::vector<Persona> completo; con decenas de
+ *          millones de registros el conjunto no cabe en la RAM.
+ * CÓMO: Las personas se leen (o generan) en lotes de tamaño fijo; cada lote se convierte
+ *       en un PersonaStore, se combina con los acumuladores de los lotes anteriores y se
+ *       descarta. Solo sobreviven los acumuladores y los ganadores de cada análisis.
+ * PARA QUÉ: Analizar conjuntos de cualquier tamaño con la memoria acotada por un presupuesto.
+ */
+
+// Presupuesto de memoria por defecto para un lote
+const size_t PRESUPUESTO_LOTES_DEFECTO = static_cast<size_t>(256) << 20;
+
+// Bytes por fila del PersonaStore (suma de los anchos de sus columnas)
+const size_t BYTES_FILA_STORE = 3 * sizeof(double) + sizeof(uint8_t) + sizeof(CiudadId) +
+                                sizeof(uint16_t) + sizeof(char) + sizeof(uint64_t);
+
+/**
+ * Filas por lote para un presupuesto.
+ *
+ * CÓMO: presupuesto / bytesPorFila redondeado hacia abajo a un múltiplo de BLOQUE_REDUCCION
+ *       (al menos un bloque), para que las sumas den exactamente lo mismo que en memoria.
+ */
+size_t filasPorLote(size_t presupuestoBytes, size_t bytesPorFila);
+
+// Origen de las personas del modo por lotes
+enum class OrigenLotes { Generado, Snapshot, Csv };
+
+// Parámetros del modo por lotes
+struct ConfigLotes {
+    OrigenLotes origen = OrigenLotes::Generado;
+    std::string ruta;                            // Snapshot o CSV
+    size_t cantidad = 0;                         // Personas a generar
+    uint64_t semilla = 0;                        // Generación
+    TipoMotor motor = TipoMotor::Xoshiro;        // Generación
+    size_t presupuesto = PRESUPUESTO_LOTES_DEFECTO;
+};
+
+/**
+ * Análisis completo (longevidad, patrimonio, declarantes, promedio por ciudad y
+ * mayores de 60) acumulado lote a lote.
+ *
+ * POR QUÉ: Un lote solo ve sus filas; el resultado global se arma combinando parciales.
+ * CÓMO: Cada lote continúa la pasada única de acumularAnalisisCompleto sobre el mismo
+ *       acumulador, con sus filas desplazadas a la posición global del lote.
+ * PARA QUÉ: Resultados idénticos a los análisis columnares sobre el conjunto completo.
+ */
+struct ResultadosLotes {
+    size_t filas = 0;   // Filas ya combinadas (la fila global de la primera del próximo lote)
+    size_t lotes = 0;
+    AnalisisCompleto analisis;
+
+    // Combina el siguiente lote: sus filas son las globales [filas, filas + lote.size())
+    void combinarLote(const PersonaStore& lote);
+
+    // true si el ganador 'k' salió del último lote combinado (de tamaño 'tamLote')
+    bool ganadorEnUltimoLote(size_t k, size_t tamLote) const {
+        return analisis.ganadores[k].fila != SIN_FILA && analisis.ganadores[k].fila + tamLote >= filas;
+    }
+};
+
+#endif // LOTES_H
@@ -0,0 +1,1823 @@
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <memory>
+#include <functional>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include "persona.h"
+#include "generador.h"
+#include "monitor.h"
+#include "contador_asignaciones.h"
+#include "paralelo.h"
+#include "buffer_salida.h"
+#include "snapshot.h"
+#include "vectorial.h"
+#include "benchmark.h"
+#include "analitica.h"
+#include "menu.h"
+
+/**
+ * Muestra el menú principal de la aplicación.
+ * 
+ * POR QUÉ: Guiar al usuario a través de las funcionalidades disponibles.
+ * CÓMO: Imprimiendo las opciones en consola.
+ * PARA QUÉ: Interacción amigable con el usuario.
+ */
+void mostrarMenu() {
+    std::cout << "\n\n=== MENÚ PRINCIPAL ===";
+    std::cout << "\n0. Crear nuevo conjunto de datos";
+    std::cout << "\n1. Mostrar resumen de todas las personas";
+    std::cout << "\n2. Mostrar detalle completo por índice";
+    std::cout << "\n3. Buscar persona por ID";
+    std::cout << "\n4. Persona más longeva";
+    std::cout << "\n5. Persona con mayor patrimonio";
+    std::cout << "\n6. Declarantes de renta por calendario";
+    std::cout << "\n7. Ciudades por patrimonio promedio";
+    std::cout << "\n8. Porcentaje mayores 60 años por calendario";
+    std::cout << "\n9. Mostrar estadísticas de rendimiento";
+    std::cout << "\n10. Exportar estadísticas a CSV";
+    std::cout << "\n11. Salir";
+    std::cout << "\n12. Alternar modo de análisis (columnar / objetos)";
+    std::cout << "\n13. Buscar lote de IDs (índice)";
+    std::cout << "\n14. Benchmark de asignaciones por análisis";
+    std::cout << "\n15. Configurar semilla y motor de generación";
+    std::cout << "\n16. Exportar resumen a archivo o pipe";
+    std::cout << "\n17. Declarantes: solo conteo o paginado";
+    std::cout << "\n18. Guardar snapshot binario";
+    std::cout << "\n19. Cargar snapshot binario (mmap)";
+    std::cout << "\n20. Exportar personas a CSV";
+    std::cout << "\n21. Importar personas desde CSV";
+    std::cout << "\n22. Análisis por lotes (fuera de memoria)";
+    std::cout << "\n23. Todos los análisis en una pasada";
+    std::cout << "\n24. Agregados mantenidos (sin recorrer los datos)";
+    std::cout << "\n25. Agregar persona";
+    std::cout << "\n26. Modificar persona";
+    std::cout << "\n27. Eliminar persona";
+    std::cout << "\n28. Construir índices ordenados (patrimonio, ingresos, deudas, fecha)";
+    std::cout << "\n29. Consultas por índice ordenado (top-K, percentil, rango)";
+    std::cout << "\n30. Distribución de riqueza (top-K por ciudad, deciles, medianas)";
+    std::cout << "\n31. Microbenchmark de núcleos vectoriales (SSE2/AVX2)";
+    std::cout << "\n32. Comparar diseños de memoria (analitica.h)";
+    std::cout << "\nSeleccione una opción: ";
+}
+
+/**
+ * Nombre con el que se registra una operación en el monitor.
+ * 
+ * POR QUÉ: Distinguir en las estadísticas las mediciones de cada modo de análisis.
+ * CÓMO: Agregando el sufijo " (columnar)" cuando se usó el PersonaStore.
+ * PARA QUÉ: Comparar ambas versiones en el mismo resumen.
+ */
+std::string nombreOperacion(const std::string& operacion, bool columnar) {
+    return columnar ? operacion + " (columnar)" : operacion;
+}
+
+/**
+ * Escribe el resumen de todas las personas en un buffer de salida.
+ * 
+ * POR QUÉ: Con std::cout, listar 2M personas tarda más de 30 segundos.
+ * CÓMO: Cada fila ("i. [id] nombre apellido | ciudad | $ingresos") se formatea en el
+ *       buffer, que se vacía con pocas llamadas a write(2).
+ * PARA QUÉ: La opción 1 (terminal) y la 16 (archivo o pipe) comparten el mismo formato.
+ */
+void escribirResumenes(const ColeccionPersonas& personas, BufferSalida& salida) {
+    salida.agregar("\n=== RESUMEN DE PERSONAS (");
+    salida.agregarEntero(personas.size());
+    salida.agregar(") ===\n");
+    for (size_t i = 0; i < personas.size(); ++i) {
+        salida.agregarEntero(i);
+        salida.agregar(". ", 2);
+        personas.persona(i).escribirResumen(salida);
+        salida.agregar('\n');
+    }
+    salida.vaciar();
+}
+
+/**
+ * Explica por qué falló una exportación con BufferSalida (opciones 16 y 20).
+ * 
+ * POR QUÉ: "No se pudo escribir" no distingue un destino inválido de un lector que
+ *          terminó antes de tiempo (p. ej. "|head"), que es un uso normal de un pipe.
+ */
+void informarFalloSalida(const BufferSalida& salida, const std::string& destino) {
+    if (salida.lectorCerro()) {
+        std::cout << "El lector de '" << destino << "' cerró el pipe antes de recibir todo ("
+                  << salida.bytesEscritos() << " bytes escritos";
+        if (salida.codigoComando() != 0) std::cout << ", código de salida " << salida.codigoComando();
+        std::cout << ")\n";
+    } else if (salida.codigoComando() != 0) {
+        std::cout << "El comando de '" << destino << "' terminó con código " << salida.codigoComando() << "\n";
+    } else {
+        std::cout << "No se pudo escribir en '" << destino << "'\n";
+    }
+}
+
+/**
+ * Rellena un texto UTF-8 con espacios hasta 'ancho' caracteres visibles.
+ * 
+ * POR QUÉ: std::setw cuenta bytes, y las tildes ocupan dos bytes en UTF-8.
+ * CÓMO: Contando solo los bytes que no son de continuación (10xxxxxx).
+ * PARA QUÉ: Alinear las columnas de las tablas en consola.
+ */
+std::string rellenar(const std::string& texto, size_t ancho) {
+    size_t visibles = 0;
+    for (unsigned char c : texto) visibles += ((c & 0xC0) != 0x80);
+    return (visibles < ancho) ? texto + std::string(ancho - visibles, ' ') : texto;
+}
+
+/**
+ * Un análisis medible en modo objetos y en modo columnar.
+ */
+struct CasoAnalisis {
+    const char* clave;                // Nombre para --analisis y para los resultados
+    const char* nombre;               // Nombre en las tablas de consola
+    std::function<void()> objetos;    // nullptr si no tiene versión por objetos
+    std::function<void()> columnar;
+};
+
+/**
+ * Análisis que miden los benchmarks (opción 14 y --benchmark).
+ * 
+ * POR QUÉ: Ambos benchmarks deben medir exactamente las mismas llamadas.
+ * CÓMO: Cada caso captura 'personas' y 'store' por referencia; los casos de objetos
+ *       recorren personas.objetos() (la colección debe ser propia) y los columnares
+ *       solo se pueden ejecutar si 'store' no es nulo.
+ */
+std::vector<CasoAnalisis> casosAnalisis(const ColeccionPersonas& personas, const PersonaStore* store) {
+    return {
+        {"longeva", "Más longeva (país)",
+            [&personas] { encontrarPersonaMasLongeva(personas.objetos()); },
+            [&personas, store] { Persona copia; encontrarPersonaMasLongeva(personas, *store, copia); }},
+        {"longeva-ciudad", "Más longeva por ciudad",
+            [&personas] { encontrarLongevasPorCiudad(personas.objetos()); },
+            [&personas, store] { encontrarLongevasPorCiudad(personas, *store); }},
+        {"patrimonio", "Mayor patrimonio (país)",
+            [&personas] { encontrarMayorPatrimonio(personas.objetos()); },
+            [&personas, store] { Persona copia; encontrarMayorPatrimonio(personas, *store, copia); }},
+        {"patrimonio-ciudad", "Mayor patrimonio por ciudad",
+            [&personas] { encontrarMayorPatrimonioPorCiudad(personas.objetos()); },
+            [&personas, store] { encontrarMayorPatrimonioPorCiudad(personas, *store); }},
+        {"patrimonio-grupo", "Mayor patrimonio por grupo",
+            [&personas] { encontrarMayorPatrimonioPorGrupoDIAN(personas.objetos()); },
+            [&personas, store] { encontrarMayorPatrimonioPorGrupoDIAN(personas, *store); }},
+        {"declarantes", "Declarantes por calendario",
+            [&personas] { listarDeclarantesPorGrupo(personas.objetos()); },
+            [&personas, store] { listarDeclarantesPorGrupo(personas, *store); }},
+        {"ciudades", "Ciudades por patrimonio",
+            [&personas] { analizarCiudadesPorPatrimonioPromedio(personas.objetos()); },
+            [store] { analizarCiudadesPorPatrimonioPromedio(*store); }},
+        {"mayores60", "Mayores 60 por calendario",
+            [&personas] { analizarPorcentajeMayores60PorCalendario(personas.objetos()); },
+            [store] { analizarPorcentajeMayores60PorCalendario(*store); }},
+        {"distribucion", "Distribución (top-100)",
+            [&personas] { analizarDistribucionRiqueza(personas.objetos(), 100, false); },
+            [&personas, store] { analizarDistribucionRiqueza(personas, *store, 100, false); }},
+        {"todo", "Todos (una pasada)",
+            nullptr,   // Solo columnar
+            [&personas, store] { analizarTodo(personas, *store); }},
+    };
+}
+
+/**
+ * Ejecuta cada análisis con la salida silenciada y reporta sus asignaciones dinámicas.
+ * 
+ * POR QUÉ: El tiempo y la memoria no muestran cuántas copias (strings, nodos de map,
+ *          vectores copiados por valor) hace cada análisis.
+ * CÓMO: Leyendo el contador global de operator new antes y después de cada análisis,
+ *       en modo objetos y, si existe el almacén, en modo columnar.
+ * PARA QUÉ: Comparar el costo en asignaciones entre modos y entre variantes.
+ * 
+ * @return Tiempo total de los análisis en milisegundos.
+ */
+double benchmarkAsignaciones(const ColeccionPersonas& personas, const PersonaStore* store) {
+    std::vector<CasoAnalisis> casos = casosAnalisis(personas, store);
+    
+    std::cout << "\n=== BENCHMARK DE ASIGNACIONES (" << personas.size() << " personas) ===\n";
+    std::cout << rellenar("Análisis", 30) << rellenar("Modo", 10)
+              << std::setw(14) << "Asignaciones" << std::setw(14) << "KB"
+              << std::setw(12) << "ms" << "\n";
+    
+    Monitor cronometro;
+    double total = 0;
+    for (const auto& caso : casos) {
+        for (int modo = 0; modo < 2; ++modo) {
+            if (modo == 1 && !store) continue;
+            const std::function<void()>& analisis = (modo == 0) ? caso.objetos : caso.columnar;
+            if (!analisis) continue;
+            
+            // Los listados no deben contar en la medición
+            double tiempo;
+            ConteoAsignaciones delta;
+            {
+                SalidaSilenciada silencio;
+                ConteoAsignaciones antes = leerAsignaciones();
+                cronometro.iniciar_tiempo();
+                analisis();
+                tiempo = cronometro.detener_tiempo();
+                delta = leerAsignaciones() - antes;
+            }
+            
+            total += tiempo;
+            std::cout << rellenar(caso.nombre, 30) << rellenar(modo == 0 ? "objetos" : "columnar", 10)
+                      << std::setw(14) << delta.asignaciones 
+                      << std::setw(14) << delta.bytes / 1024
+                      << std::setw(12) << std::fixed << std::setprecision(2) << tiempo << "\n";
+        }
+    }
+    return total;
+}
+
+/**
+ * Mide cada núcleo de vectorial.h en los niveles disponibles sobre las columnas del almacén.
+ * 
+ * POR QUÉ: Comprobar cuánto ganan las versiones SSE2/AVX2 frente al bucle escalar original
+ *          y qué tan cerca quedan del ancho de banda de memoria.
+ * CÓMO: Cada núcleo recorre la columna completa en un solo hilo, 'repeticiones' veces por
+ *       nivel (steady_clock: los tiempos son de fracciones de milisegundo); se informa la
+ *       mediana, los GB/s leídos, la aceleración frente al escalar y si el resultado
+ *       coincide con el del escalar.
+ * PARA QUÉ: Decidir con datos qué recorridos vale la pena vectorizar.
+ * 
+ * @return Tiempo total de las mediciones en milisegundos.
+ */
+double microbenchmarkVectorial(const PersonaStore& store, int repeticiones) {
+    const size_t n = store.size();
+    const double* patrimonio = store.patrimonio.data();
+    const uint8_t* declara = store.declaranteRenta.data();
+    const char* grupos = store.grupoDIAN.data();
+    const uint16_t* anios = store.anioNacimiento.data();
+    const CiudadId* ciudades = store.ciudad.data();
+    const uint16_t anioLimite = static_cast<uint16_t>(ANIO_ACTUAL - 60);
+    
+    struct Nucleo {
+        const char* nombre;
+        size_t bytesPorFila;                                  // Bytes leídos por fila
+        NivelSimd nivelMaximo;                                // Niveles con versión propia
+        std::function<std::vector<double>(NivelSimd)> medir;  // Resultado, para compararlo entre niveles
+    };
+    std::vector<Nucleo> nucleos = {
+        {"Máximo (posición)", sizeof(double), NivelSimd::AVX2,
+            [&](NivelSimd nivel) {
+                return std::vector<double>{static_cast<double>(posicionMaximo(patrimonio, n, nivel))};
+            }},
+        {"Suma con máscara (declarantes)", sizeof(double) + 1, NivelSimd::AVX2,
+            [&](NivelSimd nivel) { return std::vector<double>{sumaConMascara(patrimonio, declara, n, nivel)}; }},
+        {"Conteo con máscara (grupo DIAN)", 2, NivelSimd::AVX2,
+            [&](NivelSimd nivel) {
+                size_t total[3] = {}, marcados[3] = {};
+                contarMarcadosPorGrupo(grupos, 'A', 3, declara, n, total, marcados, nivel);
+                return std::vector<double>(total, total + 3);
+            }},
+        {"Conteo año < límite (grupo DIAN)", 3, NivelSimd::AVX2,
+            [&](NivelSimd nivel) {
+                size_t total[3] = {}, menores[3] = {};
+                contarMenoresPorGrupo(grupos, 'A', 3, anios, anioLimite, n, total, menores, nivel);
+                return std::vector<double>(menores, menores + 3);
+            }},
+        {"Suma y conteo por ciudad", sizeof(double) + 1, NivelSimd::Escalar,
+            [&](NivelSimd) {
+                std::vector<double> sumas(NUM_CIUDADES, 0.0);
+                size_t conteos[NUM_CIUDADES] = {};
+                acumularPorGrupo(ciudades, patrimonio, n, sumas.data(), conteos);
+                sumas.insert(sumas.end(), conteos, conteos + NUM_CIUDADES);
+                return sumas;
+            }},
+    };
+    
+    std::cout << "\n=== MICROBENCHMARK DE NÚCLEOS VECTORIALES (" << n << " filas, 1 hilo, "
+              << repeticiones << " repeticiones) ===\n";
+    std::cout << "Disponible: " << nombreNivelSimd(nivelSimdDisponible())
+              << ", usado por los análisis: " << nombreNivelSimd(nivelSimdActivo()) << "\n";
+    std::cout << rellenar("Núcleo", 34) << rellenar("Nivel", 10) << std::setw(12) << "ms (med.)"
+              << std::setw(10) << "GB/s" << std::setw(10) << "x escalar" << std::setw(8) << "igual" << "\n";
+    
+    double total = 0;
+    for (const auto& nucleo : nucleos) {
+        std::vector<double> referencia;
+        double tiempoEscalar = 0;
+        for (NivelSimd nivel : {NivelSimd::Escalar, NivelSimd::SSE2, NivelSimd::AVX2}) {
+            if (nivel > nivelSimdDisponible() || nivel > nucleo.nivelMaximo) continue;
+            std::vector<double> tiempos;
+            std::vector<double> resultado;
+            for (int r = 0; r < repeticiones; ++r) {
+                auto inicio = std::chrono::steady_clock::now();
+                resultado = nucleo.medir(nivel);
+                tiempos.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count());
+            }
+            std::sort(tiempos.begin(), tiempos.end());
+            double mediana = tiempos[tiempos.size() / 2];
+            for (double t : tiempos) total += t;
+            if (nivel == NivelSimd::Escalar) {
+                referencia = resultado;
+                tiempoEscalar = mediana;
+            }
+            double gbs = (mediana > 0) ? static_cast<double>(n * nucleo.bytesPorFila) / (mediana * 1e6) : 0;
+            std::cout << rellenar(nucleo.nombre, 34) << rellenar(nombreNivelSimd(nivel), 10)
+                      << std::fixed << std::setprecision(3) << std::setw(12) << mediana
+                      << std::setprecision(2) << std::setw(10) << gbs
+                      << std::setw(10) << (mediana > 0 ? tiempoEscalar / mediana : 0)
+                      << std::setw(8) << (resultado == referencia ? "sí" : "NO") << "\n";
+        }
+    }
+    return total;
+}
+
+// --- Resultados de analitica.h como números (para comprobar que los diseños coinciden) ---
+
+std::vector<double> aNumeros(size_t fila) {
+    return {static_cast<double>(fila)};
+}
+
+template <size_t N>
+std::vector<double> aNumeros(const std::array<size_t, N>& filas) {
+    return std::vector<double>(filas.begin(), filas.end());
+}
+
+std::vector<double> aNumeros(const ConteoDeclarantes& conteo) {
+    std::vector<double> numeros(conteo.total.begin(), conteo.total.end());
+    numeros.insert(numeros.end(), conteo.declarantes.begin(), conteo.declarantes.end());
+    return numeros;
+}
+
+std::vector<double> aNumeros(const ConteoMayores60& conteo) {
+    std::vector<double> numeros(conteo.total.begin(), conteo.total.end());
+    numeros.insert(numeros.end(), conteo.mayores60.begin(), conteo.mayores60.end());
+    return numeros;
+}
+
+std::vector<double> aNumeros(const std::vector<PromedioCiudad>& promedios) {
+    std::vector<double> numeros;
+    for (const auto& p : promedios) {
+        numeros.push_back(p.ciudad);
+        numeros.push_back(p.promedio);
+        numeros.push_back(static_cast<double>(p.poblacion));
+    }
+    return numeros;
+}
+
+std::vector<double> aNumeros(const AnalisisCompleto& analisis) {
+    std::vector<double> numeros;
+    for (const auto& ganador : analisis.ganadores) numeros.push_back(static_cast<double>(ganador.fila));
+    std::vector<double> resto = aNumeros(analisis.declarantes);
+    numeros.insert(numeros.end(), resto.begin(), resto.end());
+    resto = aNumeros(promediosOrdenados(analisis.patrimonio));
+    numeros.insert(numeros.end(), resto.begin(), resto.end());
+    resto = aNumeros(analisis.mayores60);
+    numeros.insert(numeros.end(), resto.begin(), resto.end());
+    return numeros;
+}
+
+/**
+ * Un análisis de analitica.h sobre un diseño concreto.
+ */
+struct AnalisisDiseno {
+    const char* clave;                            // Misma clave que en casosAnalisis
+    std::function<std::vector<double>()> medir;   // Ejecuta el análisis y devuelve su resultado
+};
+
+// Análisis de las opciones 4-8 para un diseño de memoria y un paso de parámetros
+template <typename Acceso, typename Paso>
+std::vector<AnalisisDiseno> analisisDiseno(const typename Acceso::Datos& datos) {
+    using A = Analitica<Acceso, Paso>;
+    return {
+        {"longeva", [&datos] { return aNumeros(A::masLongeva(datos)); }},
+        {"longeva-ciudad", [&datos] { return aNumeros(A::longevasPorCiudad(datos)); }},
+        {"patrimonio", [&datos] { return aNumeros(A::mayorPatrimonio(datos)); }},
+        {"patrimonio-ciudad", [&datos] { return aNumeros(A::mayorPatrimonioPorCiudad(datos)); }},
+        {"patrimonio-grupo", [&datos] { return aNumeros(A::mayorPatrimonioPorGrupo(datos)); }},
+        {"declarantes", [&datos] { return aNumeros(A::declarantesPorGrupo(datos)); }},
+        {"ciudades", [&datos] { return aNumeros(A::ciudadesPorPatrimonioPromedio(datos)); }},
+        {"mayores60", [&datos] { return aNumeros(A::mayores60PorGrupo(datos)); }},
+        {"todo", [&datos] { return aNumeros(A::completo(datos)); }},
+    };
+}
+
+/**
+ * Disposición en memoria y paso de parámetros de una especialización de Analitica.
+ */
+struct Diseno {
+    const char* disposicion;  // persona, compacta, bloques o columnar
+    const char* paso;         // referencia o valor
+    std::vector<AnalisisDiseno> analisis;
+};
+
+/**
+ * Especializaciones de analitica.h que se comparan, sobre los mismos datos.
+ * 
+ * POR QUÉ: Comparar diseños requería compilar y ejecutar una variante por diseño.
+ * CÓMO: Las personas de esta variante (métodos o campos, según AccesoPersona), filas
+ *       compactas, bloques AoSoA y el almacén columnar, cada uno por referencia y por
+ *       valor. Todos salen del mismo conjunto, así que sus resultados deben coincidir.
+ * PARA QUÉ: Agregar un diseño es construir su colección y una línea aquí.
+ */
+std::vector<Diseno> disenosAnalitica(const std::vector<Persona>& personas, const PersonaStore& store,
+                                     const std::vector<FilaCompacta>& filas, const PersonasPorBloques& bloques) {
+    return {
+        {"persona", "referencia", analisisDiseno<AccesoPersona, PasoReferencia>(personas)},
+        {"persona", "valor", analisisDiseno<AccesoPersona, PasoValor>(personas)},
+        {"compacta", "referencia", analisisDiseno<AccesoCampos<FilaCompacta>, PasoReferencia>(filas)},
+        {"compacta", "valor", analisisDiseno<AccesoCampos<FilaCompacta>, PasoValor>(filas)},
+        {"bloques", "referencia", analisisDiseno<AccesoBloques, PasoReferencia>(bloques)},
+        {"bloques", "valor", analisisDiseno<AccesoBloques, PasoValor>(bloques)},
+        {"columnar", "referencia", analisisDiseno<AccesoColumnar, PasoReferencia>(store)},
+        {"columnar", "valor", analisisDiseno<AccesoColumnar, PasoValor>(store)},
+    };
+}
+
+/**
+ * Mide los análisis de analitica.h en cada diseño de memoria, lado a lado.
+ * 
+ * POR QUÉ: Las tablas del README comparan cuatro programas con datos distintos; aquí
+ *          todas las disposiciones se miden en el mismo proceso y sobre el mismo conjunto.
+ * CÓMO: Construye las filas compactas y los bloques desde el almacén y ejecuta cada
+ *       análisis de cada diseño con medirRepeticiones (una corrida de calentamiento);
+ *       informa la mediana y si el resultado coincide con el del primer diseño.
+ * PARA QUÉ: Separar el costo de la disposición en memoria del de las copias por valor.
+ * 
+ * @return Tiempo total de las mediciones en milisegundos.
+ */
+double compararDisenos(const std::vector<Persona>& personas, const PersonaStore& store, int repeticiones) {
+    std::vector<FilaCompacta> filas = construirFilasCompactas(store);
+    PersonasPorBloques bloques = construirBloques(store);
+    std::vector<Diseno> disenos = disenosAnalitica(personas, store, filas, bloques);
+    const size_t numDisposiciones = disenos.size() / 2;  // Cada disposición: referencia y valor
+    
+    std::cout << "\n=== DISEÑOS DE MEMORIA (" << store.size() << " personas, " << repeticiones
+              << " repeticiones, mediana en ms) ===\n";
+    std::cout << "Bytes por persona: persona " << sizeof(Persona) << ", compacta " << sizeof(FilaCompacta)
+              << ", bloques " << sizeof(BloquePersonas) / BloquePersonas::FILAS_POR_BLOQUE << "\n";
+    std::cout << rellenar("Análisis", 20) << rellenar("Paso", 12);
+    for (size_t d = 0; d < numDisposiciones; ++d) std::cout << std::setw(12) << disenos[2 * d].disposicion;
+    std::cout << std::setw(8) << "igual" << "\n";
+    
+    double total = 0;
+    for (size_t a = 0; a < disenos[0].analisis.size(); ++a) {
+        std::vector<double> referencia;
+        bool iguales = true;
+        for (size_t p = 0; p < 2; ++p) {
+            std::cout << rellenar(p == 0 ? disenos[0].analisis[a].clave : "", 20) << rellenar(disenos[p].paso, 12);
+            for (size_t d = 0; d < numDisposiciones; ++d) {
+                const AnalisisDiseno& analisis = disenos[2 * d + p].analisis[a];
+                std::vector<double> resultado;
+                ConteoAsignaciones asignaciones;
+                ResumenTiempos tiempos = resumirTiempos(medirRepeticiones(
+                    [&] { resultado = analisis.medir(); }, 1, repeticiones, asignaciones));
+                if (referencia.empty()) referencia = resultado;
+                iguales = iguales && resultado == referencia;
+                total += tiempos.media * static_cast<double>(tiempos.muestras);
+                std::cout << std::fixed << std::setprecision(3) << std::setw(12) << tiempos.mediana;
+            }
+            std::cout << std::setw(8) << (p == 1 ? (iguales ? "sí" : "NO") : "") << "\n";
+        }
+    }
+    return total;
+}
+
+/**
+ * Configuración de la generación de datos.
+ * 
+ * POR QUÉ: Con semillas tomadas de la hora cada variante se mide sobre datos distintos.
+ * CÓMO: Una semilla fija (si se indicó) y el motor que usará generarColeccion.
+ * PARA QUÉ: Repetir una ejecución byte a byte y comparar las variantes con los mismos datos.
+ */
+struct ConfiguracionGeneracion {
+    bool semillaFija = false;               // true: todas las generaciones usan 'semilla'
+    uint64_t semilla = 0;                   // Semilla fija
+    TipoMotor motor = TipoMotor::Xoshiro;   // Motor de cada bloque de generación
+};
+
+/**
+ * Aplica la semilla a todas las fuentes aleatorias del programa.
+ * 
+ * POR QUÉ: Además de generarColeccion, rand() (opción 13) y el motor compartido
+ *          (generarPersona() sin argumentos) deben repetirse entre ejecuciones.
+ * CÓMO: Sembrando ambos con la semilla fija, o con la hora si no hay semilla fija.
+ */
+void aplicarSemilla(const ConfiguracionGeneracion& config) {
+    uint64_t semilla = config.semillaFija ? config.semilla : static_cast<uint64_t>(time(nullptr));
+    srand(static_cast<unsigned>(semilla));
+    sembrarGenerador(semilla);
+}
+
+/**
+ * Configuración del modo benchmark (--benchmark).
+ * 
+ * POR QUÉ: Las tablas del README se tomaron a mano, una corrida por análisis desde el
+ *          menú: no muestran la variación entre corridas ni se pueden repetir.
+ * CÓMO: Tamaños, análisis y repeticiones leídos de la línea de comandos.
+ * PARA QUÉ: Que un script (benchmark.sh) mida las cuatro variantes en varios tamaños
+ *           y guarde resultados comparables entre ejecuciones.
+ */
+struct ConfiguracionBenchmark {
+    bool activo = false;
+    std::vector<int> tamanos = {10000, 100000};  // Personas de cada conjunto
+    std::vector<std::string> analisis;           // Claves de casosAnalisis (vacío = todas)
+    int calentamiento = 1;                       // Corridas sin medir antes de las medidas
+    int repeticiones = 5;                        // Corridas medidas por análisis y modo
+    bool json = false;                           // false: CSV
+    std::string salida;                          // Archivo de resultados (vacío = salida estándar)
+    std::string variante = "programa";           // Etiqueta de la variante en los resultados
+};
+
+// Separa una lista "a,b,c" (sin elementos vacíos)
+std::vector<std::string> separarLista(const std::string& lista) {
+    std::vector<std::string> elementos;
+    size_t inicio = 0;
+    while (inicio <= lista.size()) {
+        size_t coma = lista.find(',', inicio);
+        if (coma == std::string::npos) coma = lista.size();
+        if (coma > inicio) elementos.push_back(lista.substr(inicio, coma - inicio));
+        inicio = coma + 1;
+    }
+    return elementos;
+}
+
+// Lee una lista de tamaños; acepta notación científica (1e6) si el valor es entero
+bool leerTamanos(const std::string& lista, std::vector<int>& tamanos) {
+    tamanos.clear();
+    for (const std::string& elemento : separarLista(lista)) {
+        char* fin = nullptr;
+        double valor = std::strtod(elemento.c_str(), &fin);
+        if (*fin != '\0' || valor < 1 || valor > std::numeric_limits<int>::max() ||
+            valor != static_cast<double>(static_cast<int>(valor))) {
+            return false;
+        }
+        tamanos.push_back(static_cast<int>(valor));
+    }
+    return !tamanos.empty();
+}
+
+// Lee un entero >= minimo
+bool leerEntero(const char* texto, int minimo, int& valor) {
+    char* fin = nullptr;
+    long leido = std::strtol(texto, &fin, 10);
+    if (*fin != '\0' || leido < minimo || leido > std::numeric_limits<int>::max()) return false;
+    valor = static_cast<int>(leido);
+    return true;
+}
+
+/**
+ * Ejecuta el benchmark sin menú y escribe los resultados en JSON o CSV.
+ * 
+ * POR QUÉ: Medir regresiones y curvas de escalamiento requiere corridas repetidas,
+ *          estadísticas y un formato que se pueda procesar sin leer la consola.
+ * CÓMO: Para cada tamaño genera el conjunto con la semilla fija y construye el almacén
+ *       columnar (una medición cada uno: repetirlos duplicaría la memoria máxima); luego
+ *       mide cada análisis elegido, en modo objetos y columnar, con medirRepeticiones
+ *       (calentamiento + repeticiones con la salida silenciada). El progreso va a stderr
+ *       para que la salida estándar solo tenga los resultados.
+ * PARA QUÉ: Comparar las cuatro variantes con los mismos datos y la misma metodología.
+ * 
+ * @return Código de salida del programa.
+ */
+int ejecutarBenchmark(const ConfiguracionGeneracion& config, const ConfiguracionBenchmark& benchmark) {
+    // Validar los análisis antes de generar datos
+    ColeccionPersonas vacio;
+    std::vector<CasoAnalisis> disponibles = casosAnalisis(vacio, nullptr);
+    for (const std::string& clave : benchmark.analisis) {
+        bool existe = clave == "disenos";
+        for (const auto& caso : disponibles) existe = existe || clave == caso.clave;
+        if (!existe) {
+            std::cerr << "Análisis desconocido: " << clave << ". Disponibles:";
+            for (const auto& caso : disponibles) std::cerr << " " << caso.clave;
+            std::cerr << " disenos\n";
+            return 1;
+        }
+    }
+    auto pedido = [&](const char* clave) {
+        return std::find(benchmark.analisis.begin(), benchmark.analisis.end(), clave) != benchmark.analisis.end();
+    };
+    auto elegido = [&](const char* clave) { return benchmark.analisis.empty() || pedido(clave); };
+    
+    ResultadoBenchmark base;
+    base.variante = benchmark.variante;
+    base.semilla = config.semilla;
+    base.hilos = hilosEfectivos(0);
+    base.simd = nombreNivelSimd(nivelSimdActivo());
+    base.compilacion = BANDERAS_COMPILACION;
+    
+    std::vector<ResultadoBenchmark> resultados;
+    for (int n : benchmark.tamanos) {
+        std::cerr << "[" << benchmark.variante << "] " << n << " personas\n";
+        base.personas = static_cast<size_t>(n);
+        ColeccionPersonas personas;
+        std::unique_ptr<PersonaStore> store;
+        
+        ResultadoBenchmark generar = base;
+        generar.analisis = "generar";
+        generar.modo = "preparacion";
+        generar.tiempos = resumirTiempos(medirRepeticiones(
+            [&] { personas = ColeccionPersonas(generarColeccion(n, config.semilla, 0, config.motor)); }, 0, 1,
+            generar.asignaciones));
+        resultados.push_back(generar);
+        
+        ResultadoBenchmark columnar = base;
+        columnar.analisis = "columnar";
+        columnar.modo = "preparacion";
+        columnar.tiempos = resumirTiempos(medirRepeticiones(
+            [&] { store = std::make_unique<PersonaStore>(construirStore(personas.objetos())); }, 0, 1,
+            columnar.asignaciones));
+        resultados.push_back(columnar);
+        
+        for (const auto& caso : casosAnalisis(personas, store.get())) {
+            if (!elegido(caso.clave)) continue;
+            for (int modo = 0; modo < 2; ++modo) {
+                const std::function<void()>& analisis = (modo == 0) ? caso.objetos : caso.columnar;
+                if (!analisis) continue;
+                
+                ResultadoBenchmark resultado = base;
+                resultado.analisis = caso.clave;
+                resultado.modo = (modo == 0) ? "objetos" : "columnar";
+                resultado.calentamiento = benchmark.calentamiento;
+                resultado.tiempos = resumirTiempos(medirRepeticiones(analisis, benchmark.calentamiento,
+                                                                     benchmark.repeticiones, resultado.asignaciones));
+                resultados.push_back(resultado);
+                std::cerr << "  " << rellenar(caso.clave, 18) << rellenar(resultado.modo, 10)
+                          << "mediana " << std::fixed << std::setprecision(3) << resultado.tiempos.mediana
+                          << " ms, p95 " << resultado.tiempos.p95 << " ms\n";
+            }
+        }
+        
+        // Diseños de memoria de analitica.h (solo si se piden: cada uno copia el conjunto)
+        if (!pedido("disenos")) continue;
+        std::vector<FilaCompacta> filas = construirFilasCompactas(*store);
+        PersonasPorBloques bloques = construirBloques(*store);
+        for (const Diseno& diseno : disenosAnalitica(personas.objetos(), *store, filas, bloques)) {
+            for (const AnalisisDiseno& analisis : diseno.analisis) {
+                ResultadoBenchmark resultado = base;
+                resultado.analisis = analisis.clave;
+                resultado.modo = std::string(diseno.disposicion) + "/" + diseno.paso;
+                resultado.calentamiento = benchmark.calentamiento;
+                resultado.tiempos = resumirTiempos(medirRepeticiones([&analisis] { analisis.medir(); },
+                    benchmark.calentamiento, benchmark.repeticiones, resultado.asignaciones));
+                resultados.push_back(resultado);
+            }
+            std::cerr << "  disenos           " << rellenar(std::string(diseno.disposicion) + "/" + diseno.paso, 20)
+                      << "todo: mediana " << std::fixed << std::setprecision(3)
+                      << resultados.back().tiempos.mediana << " ms\n";
+        }
+    }
+    
+    std::ofstream archivo;
+    if (!benchmark.salida.empty()) {
+        archivo.open(benchmark.salida);
+        if (!archivo) {
+            std::cerr << "Error al abrir archivo: " << benchmark.salida << "\n";
+            return 1;
+        }
+    }
+    std::ostream& salida = benchmark.salida.empty() ? std::cout : archivo;
+    if (benchmark.json) escribirResultadosJson(salida, resultados);
+    else escribirResultadosCsv(salida, resultados);
+    salida.flush();
+    return salida ? 0 : 1;
+}
+
+/**
+ * Lee los argumentos de línea de comandos.
+ * 
+ * POR QUÉ: Fijar la semilla antes de mostrar el menú, sin interacción (scripts de benchmark).
+ * CÓMO: Reconociendo --semilla N, --motor mt19937|xoshiro, --hilos N
+ *       (hilos para generación y análisis; por defecto todos los disponibles) y
+ *       --simd escalar|sse2|avx2 (nivel máximo de los núcleos vectoriales) y
+ *       --contadores (contadores de hardware en el monitor, si el sistema los permite) y
+ *       --asignaciones (asignaciones y pico de memoria dinámica por operación).
+ *       --benchmark ejecuta ejecutarBenchmark en lugar del menú, con --personas N[,N...],
+ *       --analisis clave[,clave...], --calentamiento W, --repeticiones R,
+ *       --formato csv|json, --salida archivo y --variante nombre ("disenos" en
+ *       --analisis agrega los diseños de memoria de analitica.h).
+ * @return false si algún argumento es inválido.
+ */
+bool leerArgumentos(int argc, char* argv[], ConfiguracionGeneracion& config, bool& contadores,
+                    bool& asignaciones, ConfiguracionBenchmark& benchmark) {
+    bool opcionesBenchmark = false;  // Solo tienen sentido con --benchmark
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--semilla" && i + 1 < argc) {
+            char* fin = nullptr;
+            config.semilla = std::strtoull(argv[++i], &fin, 10);
+            if (*fin != '\0') return false;
+            config.semillaFija = true;
+        } else if (arg == "--motor" && i + 1 < argc) {
+            if (!leerTipoMotor(argv[++i], config.motor)) return false;
+        } else if (arg == "--hilos" && i + 1 < argc) {
+            char* fin = nullptr;
+            unsigned long hilos = std::strtoul(argv[++i], &fin, 10);
+            if (*fin != '\0' || hilos == 0) return false;
+            hilosPorDefecto() = static_cast<unsigned>(hilos);
+        } else if (arg == "--simd" && i + 1 < argc) {
+            if (!leerNivelSimd(argv[++i], limiteNivelSimd())) return false;
+        } else if (arg == "--contadores") {
+            contadores = true;
+        } else if (arg == "--asignaciones") {
+            asignaciones = true;
+        } else if (arg == "--benchmark") {
+            benchmark.activo = true;
+        } else if (arg == "--personas" && i + 1 < argc) {
+            if (!leerTamanos(argv[++i], benchmark.tamanos)) return false;
+            opcionesBenchmark = true;
+        } else if (arg == "--analisis" && i + 1 < argc) {
+            benchmark.analisis = separarLista(argv[++i]);
+            opcionesBenchmark = true;
+        } else if (arg == "--calentamiento" && i + 1 < argc) {
+            if (!leerEntero(argv[++i], 0, benchmark.calentamiento)) return false;
+            opcionesBenchmark = true;
+        } else if (arg == "--repeticiones" && i + 1 < argc) {
+            if (!leerEntero(argv[++i], 1, benchmark.repeticiones)) return false;
+            opcionesBenchmark = true;
+        } else if (arg == "--formato" && i + 1 < argc) {
+            std::string formato = argv[++i];
+            if (formato != "csv" && formato != "json") return false;
+            benchmark.json = (formato == "json");
+            opcionesBenchmark = true;
+        } else if (arg == "--salida" && i + 1 < argc) {
+            benchmark.salida = argv[++i];
+            opcionesBenchmark = true;
+        } else if (arg == "--variante" && i + 1 < argc) {
+            benchmark.variante = argv[++i];
+            opcionesBenchmark = true;
+        } else {
+            return false;
+        }
+    }
+    return benchmark.activo || !opcionesBenchmark;
+}
+
+/**
+ * Implementación de ejecutarPrograma.
+ * 
+ * POR QUÉ: Iniciar la aplicación y manejar el flujo principal.
+ * CÓMO: Mediante un bucle que muestra el menú y procesa la opción seleccionada.
+ * PARA QUÉ: Ejecutar las funcionalidades del sistema.
+ */
+int ejecutarPrograma(int argc, char* argv[]) {
+    ConfiguracionGeneracion config;
+    bool contadores = false;
+    bool asignaciones = false;
+    ConfiguracionBenchmark benchmark;
+    if (!leerArgumentos(argc, argv, config, contadores, asignaciones, benchmark)) {
+        std::cerr << "Uso: " << argv[0] << " [--semilla N] [--motor mt19937|xoshiro] [--hilos N] [--simd escalar|sse2|avx2]"
+                  << " [--contadores] [--asignaciones]\n"
+                  << "     " << argv[0] << " --benchmark [--personas N[,N...]] [--analisis clave[,clave...]]"
+                  << " [--calentamiento W] [--repeticiones R] [--formato csv|json] [--salida archivo]"
+                  << " [--variante nombre] [--semilla N] [--motor ...] [--hilos N] [--simd ...]\n";
+        return 1;
+    }
+    if (benchmark.activo) {
+        // Sin --semilla, una fija: todas las variantes deben medirse sobre los mismos datos
+        if (!config.semillaFija) {
+            config.semillaFija = true;
+            config.semilla = 1;
+        }
+        aplicarSemilla(config);
+        return ejecutarBenchmark(config, benchmark);
+    }
+    aplicarSemilla(config); // Semilla para generación aleatoria
+    if (config.semillaFija) {
+        std::cout << "Modo reproducible: semilla " << config.semilla 
+                  << ", motor " << nombreMotor(config.motor) << "\n";
+    }
+    
+    // Puntero inteligente para gestionar la colección de personas
+    // POR QUÉ: Evitar fugas de memoria y garantizar liberación automática.
+    // Tras cargar un snapshot es una vista: solo se arman las personas que se usan
+    std::unique_ptr<ColeccionPersonas> personas = nullptr;
+    
+    // Arena con los nombres y apellidos de 'personas' si se leyeron de un archivo
+    // (las generadas apuntan al catálogo del generador); se libera junto con ellas
+    std::unique_ptr<ArenaTextos> textos = nullptr;
+    
+    // Almacén columnar alineado con 'personas' (fila i = persona i)
+    std::unique_ptr<PersonaStore> store = nullptr;
+    bool usarColumnar = true; // Los análisis 4-8 recorren el almacén columnar
+    
+    // Índice de IDs a filas (búsqueda en O(1) para las opciones 3 y 13)
+    std::unique_ptr<IndiceID> indiceIds = nullptr;
+    
+    // Agregados que las altas, cambios y bajas mantienen al día (se calculan la primera
+    // vez que se consultan o se modifica el conjunto)
+    std::unique_ptr<AgregadosPersonas> agregados = nullptr;
+    
+    // Índices ordenados opcionales por campo (opción 28); se descartan si el conjunto cambia
+    std::array<std::unique_ptr<IndiceOrden>, NUM_CAMPOS_ORDEN> indicesOrden;
+    
+    // Snapshot abierto con mmap (si el conjunto se cargó de un archivo)
+    std::unique_ptr<Snapshot> snapshot = nullptr;
+    
+    Monitor monitor; // Monitor para medir rendimiento
+    if (contadores) {
+        std::string error;
+        bool abiertos = monitor.activar_contadores(error);
+        if (!abiertos) std::cout << "Contadores de hardware no disponibles: " << error << "\n";
+        else if (!error.empty()) std::cout << "Contadores de hardware sin: " << error << "\n";
+    }
+    if (asignaciones) monitor.activar_asignaciones();
+    
+    // Informa cuánta memoria ahorra la arena de textos frente a un std::string por campo
+    auto registrarTextos = [&](const std::string& origen) {
+        UsoTextos uso = medirTextos(personas->objetos(), textos.get());
+        long ahorro = static_cast<long>(uso.ahorro() / 1024);
+        std::cout << "Textos en arena: " << uso.bytesActuales / 1024 << " KB (con std::string: "
+                  << uso.bytesComoString / 1024 << " KB, ahorro: " << ahorro << " KB)\n";
+        monitor.registrar_ahorro("arena de textos, " + origen, ahorro);
+    };
+    
+    // Indica si hay un conjunto de personas (generado, importado o cargado de un snapshot)
+    auto hayPersonas = [&]() { return personas && !personas->empty(); };
+    
+    // Vector completo de personas para el modo de objetos y los benchmarks que lo miden
+    // (opciones 14 y 32); tras cargar un snapshot se construye la primera vez que se pide
+    auto objetos = [&]() -> const std::vector<Persona>& {
+        if (personas->esVista()) {
+            Monitor medidor;
+            medidor.iniciar_tiempo();
+            long memoria_antes = monitor.obtener_memoria();
+            personas->hacerPropia();
+            double tiempo = medidor.detener_tiempo();
+            long memoria = monitor.obtener_memoria() - memoria_antes;
+            std::cout << "\nPersonas construidas desde el snapshot en " << tiempo 
+                      << " ms, Memoria: " << memoria << " KB\n";
+            monitor.registrar("Construir personas (snapshot)", tiempo, memoria);
+            registrarTextos("snapshot");
+        }
+        return personas->objetos();
+    };
+    
+    // Construye el almacén columnar y el índice de IDs del conjunto actual de personas
+    auto construirAuxiliares = [&]() {
+        // Construir el almacén columnar (medido aparte para no mezclarlo con la generación o la lectura)
+        Monitor medidor;
+        monitor.iniciar_desglose(personas->size());
+        medidor.iniciar_tiempo();
+        long memoria_store_inicio = monitor.obtener_memoria();
+        store = std::make_unique<PersonaStore>(construirStore(personas->objetos()));
+        double tiempo_store = medidor.detener_tiempo();
+        long memoria_store = monitor.obtener_memoria() - memoria_store_inicio;
+        
+        std::cout << "Almacén columnar construido en " << tiempo_store 
+                  << " ms, Memoria: " << memoria_store << " KB\n";
+        monitor.registrar("Construir columnar", tiempo_store, memoria_store);
+        
+        // Construir el índice de IDs sobre la columna de IDs del almacén
+        medidor.iniciar_tiempo();
+        long memoria_indice_inicio = monitor.obtener_memoria();
+        indiceIds = std::make_unique<IndiceID>();
+        indiceIds->construir(store->id.data(), store->size());
+        double tiempo_indice = medidor.detener_tiempo();
+        long memoria_indice = monitor.obtener_memoria() - memoria_indice_inicio;
+        
+        std::cout << "Índice de IDs (" << (indiceIds->esDenso() ? "denso" : "hash") 
+                  << ") construido en " << tiempo_indice << " ms, Memoria: " 
+                  << memoria_indice << " KB\n";
+        monitor.registrar("Construir índice ID", tiempo_indice, memoria_indice);
+    };
+    
+    // Descarta los índices ordenados (ya no corresponden al conjunto) y su memoria en el monitor
+    auto descartarIndicesOrden = [&]() {
+        for (size_t c = 0; c < NUM_CAMPOS_ORDEN; ++c) {
+            if (!indicesOrden[c]) continue;
+            indicesOrden[c].reset();
+            monitor.registrar_estructura(std::string("índice ordenado (") +
+                                         nombreCampoOrden(static_cast<CampoOrden>(c)) + ")", 0);
+        }
+    };
+    
+    // Agregados del conjunto actual, calculados con una pasada si todavía no existen
+    auto prepararAgregados = [&]() {
+        if (agregados) return;
+        Monitor medidor;
+        medidor.iniciar_tiempo();
+        long memoria_antes = monitor.obtener_memoria();
+        agregados = std::make_unique<AgregadosPersonas>();
+        agregados->construir(*store);
+        double tiempo = medidor.detener_tiempo();
+        long memoria = monitor.obtener_memoria() - memoria_antes;
+        std::cout << "Agregados calculados en " << tiempo << " ms\n";
+        monitor.registrar("Construir agregados", tiempo, memoria);
+    };
+    
+    // Lee una persona como una fila CSV (mismo formato que la importación)
+    auto leerPersonaCsv = [&](RegistroCsv& datos, std::string& linea, std::string& auxNombre,
+                              std::string& auxApellido) {
+        std::cout << "Fila CSV (id,nombre,apellido,AAAA-MM-DD,ciudad,ingresos,patrimonio,deudas,declarante 0/1): ";
+        std::cin >> std::ws;
+        std::getline(std::cin, linea);
+        std::string error;
+        if (!analizarRegistroCsv(linea, datos, auxNombre, auxApellido, error)) {
+            std::cout << "Error: " << error << "\n";
+            return false;
+        }
+        return true;
+    };
+    
+    int opcion;
+    do {
+        mostrarMenu();
+        std::cin >> opcion;
+        
+        // Variables locales para uso en los casos
+        size_t tam = 0;
+        int indice;
+        uint64_t idBusqueda;
+        
+        // Iniciar medición de tiempo y memoria para la operación actual
+        monitor.iniciar_desglose(store ? store->size() : 0);
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        
+        switch(opcion) {
+            case 0: { // Crear nuevo conjunto de datos
+                int n;
+                std::cout << "\nIngrese el número de personas a generar: ";
+                std::cin >> n;
+                
+                if (n <= 0) {
+                    std::cout << "Error: Debe generar al menos 1 persona\n";
+                    break;
+                }
+                
+                // Liberar el conjunto anterior antes de generar el nuevo; las personas no tienen
+                // memoria propia (sus textos están en una arena), así que es liberar un vector
+                store.reset();
+                indiceIds.reset();
+                agregados.reset();
+                descartarIndicesOrden();
+                snapshot.reset();
+                personas.reset();
+                textos.reset();
+                
+                // Generar el nuevo conjunto de personas (en paralelo, reproducible con la semilla)
+                uint64_t semilla = config.semillaFija ? config.semilla : static_cast<uint64_t>(rand());
+                auto nuevasPersonas = generarColeccion(n, semilla, 0, config.motor);
+                tam = nuevasPersonas.size();
+                
+                // Mover el conjunto al puntero inteligente (propiedad única)
+                personas = std::make_unique<ColeccionPersonas>(std::move(nuevasPersonas));
+                
+                // Medir tiempo y memoria usada
+                double tiempo_gen = monitor.detener_tiempo();
+                long memoria_gen = monitor.obtener_memoria() - memoria_inicio;
+                
+                std::cout << "Generadas " << tam << " personas en " 
+                          << tiempo_gen << " ms, Memoria: " << memoria_gen << " KB"
+                          << " [hilos: " << hilosEfectivos(0) << ", semilla: " << semilla 
+                          << ", motor: " << nombreMotor(config.motor) << "]\n";
+                
+                // Registrar la operación
+                monitor.registrar("Crear datos", tiempo_gen, memoria_gen);
+                registrarTextos("generación");
+                
+                // Almacén columnar e índice de IDs (medidos aparte para no mezclarlos con la generación)
+                construirAuxiliares();
+                break;
+            }
+                
+            case 1: { // Mostrar resumen de todas las personas
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                {
+                    BufferSalida salida(1); // Salida estándar (terminal, archivo o pipe de la shell)
+                    escribirResumenes(*personas, salida);
+                }
+                
+                double tiempo_mostrar = monitor.detener_tiempo();
+                long memoria_mostrar = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Mostrar resumen", tiempo_mostrar, memoria_mostrar);
+                break;
+            }
+                
+            case 2: { // Mostrar detalle por índice
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                tam = personas->size();
+                std::cout << "\nIngrese el índice (0-" << tam-1 << "): ";
+                if(std::cin >> indice) {
+                    if(indice >= 0 && static_cast<size_t>(indice) < tam) {
+                        personas->persona(indice).mostrar();
+                    } else {
+                        std::cout << "Índice fuera de rango!\n";
+                    }
+                } else {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                }
+                
+                double tiempo_detalle = monitor.detener_tiempo();
+                long memoria_detalle = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Mostrar detalle", tiempo_detalle, memoria_detalle);
+                break;
+            }
+                
+            case 3: { // Buscar por ID
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\nIngrese el ID a buscar: ";
+                Persona copia; // La colección entrega la persona encontrada por copia
+                if(!(std::cin >> idBusqueda)) {
+                    std::cout << "Entrada inválida! El ID es numérico.\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                } else if(const Persona* encontrada = indiceIds ? buscarPorID(*personas, *indiceIds, idBusqueda, copia)
+                                                             : buscarPorID(objetos(), idBusqueda)) {
+                    encontrada->mostrar();
+                } else {
+                    std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                }
+                
+                double tiempo_busqueda = monitor.detener_tiempo();
+                long memoria_busqueda = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Buscar por ID", tiempo_busqueda, memoria_busqueda);
+                break;
+            }
+                
+            case 4: { //Persona mas longeva
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\n=== ANÁLISIS DE LONGEVIDAD ===\n";
+                std::cout << "1. Persona más longeva del país\n";
+                std::cout << "2. Personas más longevas por ciudad\n";
+                std::cout << "Seleccione opción: ";
+                
+                int subOpcion;
+                std::cin >> subOpcion;
+                
+                bool columnar = usarColumnar && store;
+                if (subOpcion == 1) {
+                    Persona copia;
+                    const Persona* longeva = columnar ? encontrarPersonaMasLongeva(*personas, *store, copia)
+                                                      : encontrarPersonaMasLongeva(objetos());
+                    if (longeva) {
+                        std::cout << "\n PERSONA MÁS LONGEVA DEL PAÍS:\n";
+                        longeva->mostrar();
+                        std::cout << "Edad aproximada: " << AccesoPersona::edadDe(*longeva) << " años\n";
+                    }
+                } else if (subOpcion == 2) {
+                    if (columnar) encontrarLongevasPorCiudad(*personas, *store);
+                    else encontrarLongevasPorCiudad(objetos());
+                }
+                
+                double tiempo_longeva = monitor.detener_tiempo();
+                long memoria_longeva = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(nombreOperacion("Análisis longevidad", columnar), tiempo_longeva, memoria_longeva);
+                break;
+            }
+
+            case 5: { // Persona con mas patrimonio
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\n=== ANÁLISIS DE PATRIMONIO ===\n";
+                std::cout << "1. Mayor patrimonio del país\n";
+                std::cout << "2. Mayor patrimonio por ciudad\n";
+                std::cout << "3. Mayor patrimonio por grupo DIAN\n";
+                std::cout << "Seleccione opción: ";
+                
+                int subOpcion;
+                std::cin >> subOpcion;
+                
+                bool columnar = usarColumnar && store;
+                if (subOpcion == 1) {
+                    Persona copia;
+                    const Persona* rica = columnar ? encontrarMayorPatrimonio(*personas, *store, copia)
+                                                   : encontrarMayorPatrimonio(objetos());
+                    if (rica) {
+                        std::cout << "\n MAYOR PATRIMONIO DEL PAÍS:\n";
+                        rica->mostrar();
+                    }
+                } else if (subOpcion == 2) {
+                    if (columnar) encontrarMayorPatrimonioPorCiudad(*personas, *store);
+                    else encontrarMayorPatrimonioPorCiudad(objetos());
+                } else if (subOpcion == 3) {
+                    if (columnar) encontrarMayorPatrimonioPorGrupoDIAN(*personas, *store);
+                    else encontrarMayorPatrimonioPorGrupoDIAN(objetos());
+                }
+                
+                double tiempo_patrimonio = monitor.detener_tiempo();
+                long memoria_patrimonio = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(nombreOperacion("Análisis patrimonio", columnar), tiempo_patrimonio, memoria_patrimonio);
+                break;
+            }
+                
+            case 6: { // Declarantes de renta
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                bool columnar = usarColumnar && store;
+                if (columnar) listarDeclarantesPorGrupo(*personas, *store);
+                else listarDeclarantesPorGrupo(objetos());
+                
+                double tiempo_declarantes = monitor.detener_tiempo();
+                long memoria_declarantes = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(nombreOperacion("Análisis declarantes", columnar), tiempo_declarantes, memoria_declarantes);
+                break;
+            }
+
+            case 7: { // Ciudades por patrimonio promedio
+                // En modo columnar no hacen falta los objetos (p. ej. tras cargar un snapshot)
+                bool columnar = usarColumnar && store && !store->empty();
+                if (!columnar && !hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                if (columnar) analizarCiudadesPorPatrimonioPromedio(*store);
+                else analizarCiudadesPorPatrimonioPromedio(objetos());
+                
+                double tiempo_ciudades = monitor.detener_tiempo();
+                long memoria_ciudades = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(nombreOperacion("Análisis ciudades patrimonio", columnar), tiempo_ciudades, memoria_ciudades);
+                break;
+            }
+
+            case 8: { // Porcentaje mayores 60 años por calendario
+                // En modo columnar no hacen falta los objetos (p. ej. tras cargar un snapshot)
+                bool columnar = usarColumnar && store && !store->empty();
+                if (!columnar && !hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                if (columnar) analizarPorcentajeMayores60PorCalendario(*store);
+                else analizarPorcentajeMayores60PorCalendario(objetos());
+                
+                double tiempo_mayores60 = monitor.detener_tiempo();
+                long memoria_mayores60 = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(nombreOperacion("Análisis mayores 60 años", columnar), tiempo_mayores60, memoria_mayores60);
+                break;
+            }
+                
+            case 9: // Mostrar estadísticas de rendimiento
+                monitor.mostrar_resumen();
+                break;
+                
+            case 10: // Exportar estadísticas a CSV
+                monitor.exportar_csv();
+                break;
+                
+            case 11: // Salir
+                std::cout << "Saliendo...\n";
+                break;
+                
+            case 12: // Alternar modo de análisis
+                usarColumnar = !usarColumnar;
+                std::cout << "Modo de análisis: " 
+                          << (usarColumnar ? "columnar (PersonaStore)" : "objetos (std::vector<Persona>)") << "\n";
+                break;
+                
+            case 13: { // Buscar lote de IDs con el índice
+                if (!hayPersonas() || !indiceIds) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                int cantidad;
+                std::cout << "\nCantidad de IDs a buscar: ";
+                if (!(std::cin >> cantidad) || cantidad <= 0) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                
+                // Lote de prueba: IDs existentes tomados al azar y, uno de cada cuatro, uno inexistente.
+                // Los inexistentes se toman por encima del mayor ID: 'id + tam' solo es seguro si los
+                // IDs son densos, y con IDs dispersos o cargados de CSV podría caer en uno existente.
+                tam = personas->size();
+                uint64_t mayorId = *std::max_element(store->id.begin(), store->id.end());
+                std::vector<uint64_t> ids;
+                ids.reserve(cantidad);
+                for (int i = 0; i < cantidad; ++i) {
+                    ids.push_back((i % 4 == 3) ? mayorId + 1 + static_cast<uint64_t>(rand() % tam)
+                                               : store->id[rand() % tam]);
+                }
+                
+                monitor.iniciar_tiempo();
+                memoria_inicio = monitor.obtener_memoria();
+                std::vector<size_t> filas = buscarPorIDs(*indiceIds, ids);
+                double tiempo_lote = monitor.detener_tiempo();
+                long memoria_lote = monitor.obtener_memoria() - memoria_inicio;
+                
+                size_t hallados = 0;
+                for (size_t fila : filas) hallados += (fila != SIN_FILA);
+                
+                std::cout << "Lote de " << cantidad << " IDs: " << hallados << " encontrados en " 
+                          << tiempo_lote << " ms (" << (tiempo_lote * 1e6 / cantidad) << " ns por ID)\n";
+                monitor.registrar("Buscar lote IDs", tiempo_lote, memoria_lote);
+                break;
+            }
+                
+            case 14: { // Benchmark de asignaciones por análisis
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                objetos(); // El benchmark mide también el modo de objetos
+                double tiempo_benchmark = benchmarkAsignaciones(*personas, store.get());
+                long memoria_benchmark = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Benchmark asignaciones", tiempo_benchmark, memoria_benchmark);
+                break;
+            }
+                
+            case 15: { // Configurar semilla y motor de generación
+                long long nuevaSemilla;
+                std::cout << "\nSemilla (número >= 0, o -1 para usar la hora): ";
+                if (!(std::cin >> nuevaSemilla)) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                config.semillaFija = (nuevaSemilla >= 0);
+                config.semilla = config.semillaFija ? static_cast<uint64_t>(nuevaSemilla) : 0;
+                
+                std::string nombre;
+                std::cout << "Motor (mt19937 / xoshiro): ";
+                std::cin >> nombre;
+                if (!leerTipoMotor(nombre, config.motor)) {
+                    std::cout << "Motor desconocido, se conserva " << nombreMotor(config.motor) << "\n";
+                }
+                
+                aplicarSemilla(config);
+                std::cout << "Semilla: " << (config.semillaFija ? std::to_string(config.semilla) : "hora del sistema")
+                          << ", motor: " << nombreMotor(config.motor) << "\n";
+                break;
+            }
+                
+            case 16: { // Exportar resumen a archivo o pipe
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::string destino;
+                std::cout << "\nDestino (ruta de archivo o FIFO, o |comando): ";
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::getline(std::cin, destino);
+                if (destino.empty()) {
+                    std::cout << "Destino vacío!\n";
+                    break;
+                }
+                
+                size_t bytes = 0;
+                bool correcto = false;
+                {
+                    BufferSalida salida(destino);
+                    if (salida.valido()) escribirResumenes(*personas, salida);
+                    correcto = salida.cerrar();
+                    bytes = salida.bytesEscritos();
+                    if (!correcto) informarFalloSalida(salida, destino);
+                }
+                
+                double tiempo_exportar = monitor.detener_tiempo();
+                long memoria_exportar = monitor.obtener_memoria() - memoria_inicio;
+                if (!correcto) break;
+                monitor.registrar("Exportar resumen", tiempo_exportar, memoria_exportar);
+                std::cout << personas->size() << " filas (" << bytes << " bytes) escritas en '"
+                          << destino << "' en " << std::fixed << std::setprecision(2)
+                          << tiempo_exportar << " ms\n";
+                break;
+            }
+                
+            case 17: { // Declarantes: solo conteo o paginado
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                PaginaListado pagina;
+                std::cout << "\nPrimera posición por grupo (1 = inicio): ";
+                size_t primera;
+                if (!(std::cin >> primera) || primera == 0) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                std::cout << "Filas por grupo (0 = solo conteo): ";
+                if (!(std::cin >> pagina.cantidad)) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                pagina.desde = primera - 1;
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                bool columnar = usarColumnar && store;
+                {
+                    BufferSalida salida(1);
+                    if (columnar) listarDeclarantesPorGrupo(*personas, *store, salida, pagina);
+                    else listarDeclarantesPorGrupo(objetos(), salida, pagina);
+                }
+                
+                double tiempo_pagina = monitor.detener_tiempo();
+                long memoria_pagina = monitor.obtener_memoria() - memoria_inicio;
+                std::string operacion = (pagina.cantidad == 0) ? "Declarantes (conteo)" : "Declarantes (paginado)";
+                monitor.registrar(nombreOperacion(operacion, columnar), tiempo_pagina, memoria_pagina);
+                std::cout << "Tiempo: " << std::fixed << std::setprecision(2) << tiempo_pagina << " ms\n";
+                break;
+            }
+                
+            case 18: { // Guardar snapshot binario
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::string ruta;
+                std::cout << "\nRuta del snapshot: ";
+                std::cin >> ruta;
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                std::string error;
+                if (!guardarSnapshot(ruta, *personas, *store, error)) {
+                    std::cout << "Error: " << error << "\n";
+                    break;
+                }
+                double tiempo_guardar = monitor.detener_tiempo();
+                long memoria_guardar = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Guardar snapshot", tiempo_guardar, memoria_guardar);
+                std::cout << "Snapshot guardado en '" << ruta << "' (" << personas->size() 
+                          << " personas) en " << tiempo_guardar << " ms\n";
+                break;
+            }
+                
+            case 19: { // Cargar snapshot binario (mmap)
+                std::string ruta;
+                char verificar;
+                std::cout << "\nRuta del snapshot: ";
+                std::cin >> ruta;
+                std::cout << "¿Verificar la suma de todos los datos? Lee el archivo completo (s/n): ";
+                std::cin >> verificar;
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                std::string error;
+                std::unique_ptr<Snapshot> nuevo = Snapshot::abrir(ruta, verificar == 's' || verificar == 'S', error);
+                if (!nuevo) {
+                    std::cout << "Error: " << error << "\n";
+                    break;
+                }
+                
+                // Reemplazar el conjunto actual: el almacén y las personas quedan como vistas sobre
+                // el archivo (cada persona se arma solo si una opción la usa)
+                personas.reset();
+                textos.reset();
+                indiceIds.reset();
+                agregados.reset();
+                descartarIndicesOrden();
+                store = std::make_unique<PersonaStore>(nuevo->vista());
+                snapshot = std::move(nuevo);
+                textos = std::make_unique<ArenaTextos>();
+                personas = std::make_unique<ColeccionPersonas>(*snapshot, *textos);
+                indiceIds = std::make_unique<IndiceID>();
+                indiceIds->construir(store->id.data(), store->size());
+                
+                double tiempo_cargar = monitor.detener_tiempo();
+                long memoria_cargar = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Cargar snapshot", tiempo_cargar, memoria_cargar);
+                std::cout << "Snapshot cargado: " << snapshot->filas() << " personas, "
+                          << snapshot->tamArchivo() / (1024 * 1024) << " MB mapeados, en "
+                          << tiempo_cargar << " ms (índice de IDs "
+                          << (indiceIds->esDenso() ? "denso" : "hash") << ")\n";
+                if (!usarColumnar) {
+                    std::cout << "Nota: el modo de objetos construirá las personas en el primer análisis.\n";
+                }
+                break;
+            }
+                
+            case 20: { // Exportar personas a CSV
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::string destino;
+                std::cout << "\nDestino CSV (ruta de archivo o FIFO, o |comando): ";
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::getline(std::cin, destino);
+                if (destino.empty()) {
+                    std::cout << "Destino vacío!\n";
+                    break;
+                }
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                size_t bytes = 0;
+                bool correcto = false;
+                {
+                    BufferSalida salida(destino);
+                    if (salida.valido()) exportarCsv(*personas, salida);
+                    correcto = salida.cerrar();
+                    bytes = salida.bytesEscritos();
+                    if (!correcto) informarFalloSalida(salida, destino);
+                }
+                
+                double tiempo_csv = monitor.detener_tiempo();
+                long memoria_csv = monitor.obtener_memoria() - memoria_inicio;
+                if (!correcto) break;
+                monitor.registrar("Exportar CSV", tiempo_csv, memoria_csv);
+                std::cout << personas->size() << " personas (" << bytes / (1024 * 1024) << " MB) exportadas a '"
+                          << destino << "' en " << tiempo_csv << " ms\n";
+                break;
+            }
+                
+            case 21: { // Importar personas desde CSV
+                std::string ruta;
+                std::cout << "\nRuta del archivo CSV: ";
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::getline(std::cin, ruta);
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                std::string error;
+                std::vector<Persona> leidas;
+                std::unique_ptr<ArenaTextos> textosLeidos = std::make_unique<ArenaTextos>();
+                if (!importarCsv(ruta, leidas, *textosLeidos, error)) {
+                    std::cout << "Error: " << error << "\n";
+                    break;
+                }
+                if (leidas.empty()) {
+                    std::cout << "El archivo no tiene personas\n";
+                    break;
+                }
+                
+                // Reemplazar el conjunto actual
+                store.reset();
+                indiceIds.reset();
+                agregados.reset();
+                descartarIndicesOrden();
+                snapshot.reset();
+                personas = std::make_unique<ColeccionPersonas>(std::move(leidas));
+                textos = std::move(textosLeidos);
+                tam = personas->size();
+                
+                double tiempo_csv = monitor.detener_tiempo();
+                long memoria_csv = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Importar CSV", tiempo_csv, memoria_csv);
+                std::cout << "Importadas " << tam << " personas en " << tiempo_csv << " ms, Memoria: "
+                          << memoria_csv << " KB [hilos: " << hilosEfectivos(0) << "]\n";
+                registrarTextos("CSV");
+                
+                construirAuxiliares();
+                break;
+            }
+                
+            case 22: { // Análisis por lotes (fuera de memoria)
+                ConfigLotes lotes;
+                int origen;
+                std::cout << "\n=== ANÁLISIS POR LOTES ===\n";
+                std::cout << "1. Generar personas (semilla y motor configurados)\n";
+                std::cout << "2. Leer snapshot binario\n";
+                std::cout << "3. Leer archivo CSV\n";
+                std::cout << "Seleccione origen: ";
+                std::cin >> origen;
+                
+                if (origen == 1) {
+                    long long cantidad;
+                    std::cout << "Número de personas a generar: ";
+                    std::cin >> cantidad;
+                    if (cantidad <= 0) {
+                        std::cout << "Error: Debe generar al menos 1 persona\n";
+                        break;
+                    }
+                    lotes.origen = OrigenLotes::Generado;
+                    lotes.cantidad = static_cast<size_t>(cantidad);
+                    lotes.semilla = config.semillaFija ? config.semilla : static_cast<uint64_t>(rand());
+                    lotes.motor = config.motor;
+                } else if (origen == 2 || origen == 3) {
+                    lotes.origen = (origen == 2) ? OrigenLotes::Snapshot : OrigenLotes::Csv;
+                    std::cout << "Ruta del archivo: ";
+                    std::cin >> lotes.ruta;
+                } else {
+                    std::cout << "Origen inválido\n";
+                    break;
+                }
+                
+                long long presupuestoMB;
+                std::cout << "Memoria por lote en MB (0 = " << (PRESUPUESTO_LOTES_DEFECTO >> 20) << "): ";
+                std::cin >> presupuestoMB;
+                if (presupuestoMB > 0) lotes.presupuesto = static_cast<size_t>(presupuestoMB) << 20;
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                long memoriaMaxima = 0;
+                std::string error;
+                bool correcto = analizarPorLotes(lotes, [&](size_t lote, size_t filas) {
+                    long memoria = monitor.obtener_memoria();
+                    memoriaMaxima = std::max(memoriaMaxima, memoria);
+                    std::cout << "  Lote " << lote << ": " << filas << " personas, memoria residente: "
+                              << memoria << " KB\n";
+                }, error);
+                if (!correcto) {
+                    std::cout << "Error: " << error << "\n";
+                    break;
+                }
+                
+                double tiempo_lotes = monitor.detener_tiempo();
+                long memoria_lotes = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Análisis por lotes", tiempo_lotes, memoria_lotes);
+                std::cout << "\nAnálisis por lotes en " << tiempo_lotes << " ms, memoria residente máxima: "
+                          << memoriaMaxima << " KB [hilos: " << hilosEfectivos(0) << "]\n";
+                break;
+            }
+                
+            case 23: { // Todos los análisis en una pasada
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                analizarTodo(*personas, *store);
+                
+                double tiempo_todo = monitor.detener_tiempo();
+                long memoria_todo = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Todos los análisis (una pasada)", tiempo_todo, memoria_todo);
+                std::cout << "\nTodos los análisis en " << tiempo_todo << " ms [hilos: "
+                          << hilosEfectivos(0) << "]\n";
+                break;
+            }
+                
+            case 24: { // Agregados mantenidos (sin recorrer los datos)
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                prepararAgregados();
+                monitor.iniciar_tiempo(); // Sin contar el cálculo inicial
+                mostrarAgregados(*personas, *store, *agregados);
+                
+                double tiempo_agregados = monitor.detener_tiempo();
+                monitor.registrar("Consultar agregados", tiempo_agregados, monitor.obtener_memoria() - memoria_inicio);
+                std::cout << "\nAgregados consultados en " << tiempo_agregados << " ms (recorridos por ganadores "
+                          << "quitados: " << agregados->recalculos() << ")\n";
+                break;
+            }
+                
+            case 25:   // Agregar persona
+            case 26: { // Modificar persona
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                RegistroCsv datos;
+                std::string linea, auxNombre, auxApellido;
+                std::cout << "\n";
+                if (opcion == 26) std::cout << "El ID de la fila indica la persona a modificar (no se puede cambiar).\n";
+                if (!leerPersonaCsv(datos, linea, auxNombre, auxApellido)) break;
+                
+                prepararAgregados();
+                if (!textos) textos = std::make_unique<ArenaTextos>(); // Las generadas usan el catálogo
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                std::string error;
+                bool correcto = (opcion == 25)
+                    ? agregarPersona(datos, *personas, *textos, *store, *indiceIds, *agregados, error)
+                    : modificarPersona(datos, *personas, *textos, *store, *indiceIds, *agregados, error);
+                if (!correcto) {
+                    std::cout << "Error: " << error << "\n";
+                    break;
+                }
+                
+                descartarIndicesOrden();
+                double tiempo_cambio = monitor.detener_tiempo();
+                monitor.registrar(opcion == 25 ? "Agregar persona" : "Modificar persona", tiempo_cambio,
+                                  monitor.obtener_memoria() - memoria_inicio);
+                std::cout << "Persona " << datos.id << (opcion == 25 ? " agregada" : " modificada") << " en "
+                          << tiempo_cambio << " ms (" << personas->size() << " personas)\n";
+                break;
+            }
+                
+            case 27: { // Eliminar persona
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\nID de la persona a eliminar: ";
+                if (!(std::cin >> idBusqueda)) {
+                    std::cout << "Entrada inválida! El ID es numérico.\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                
+                prepararAgregados();
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                std::string error;
+                if (!eliminarPersona(idBusqueda, *personas, *store, *indiceIds, *agregados, error)) {
+                    std::cout << "Error: " << error << "\n";
+                    break;
+                }
+                
+                descartarIndicesOrden();
+                double tiempo_baja = monitor.detener_tiempo();
+                monitor.registrar("Eliminar persona", tiempo_baja, monitor.obtener_memoria() - memoria_inicio);
+                std::cout << "Persona " << idBusqueda << " eliminada en " << tiempo_baja << " ms ("
+                          << personas->size() << " personas)\n";
+                break;
+            }
+                
+            case 28: { // Construir índices ordenados
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\n";
+                for (size_t c = 0; c < NUM_CAMPOS_ORDEN; ++c) {
+                    CampoOrden campo = static_cast<CampoOrden>(c);
+                    Monitor medidor;
+                    medidor.iniciar_tiempo();
+                    long memoria_antes = monitor.obtener_memoria();
+                    indicesOrden[c].reset(); // Liberar el anterior antes de construir el nuevo
+                    indicesOrden[c] = std::make_unique<IndiceOrden>(construirIndiceOrden(*personas, *store, campo));
+                    double tiempo = medidor.detener_tiempo();
+                    long memoria = monitor.obtener_memoria() - memoria_antes;
+                    long kb = static_cast<long>(indicesOrden[c]->memoriaBytes() / 1024);
+                    
+                    std::cout << "Índice de " << nombreCampoOrden(campo) << " construido en " << tiempo
+                              << " ms, " << kb << " KB\n";
+                    monitor.registrar(std::string("Construir índice ordenado (") + nombreCampoOrden(campo) + ")",
+                                      tiempo, memoria);
+                    monitor.registrar_estructura(std::string("índice ordenado (") + nombreCampoOrden(campo) + ")", kb);
+                }
+                std::cout << "[hilos: " << hilosEfectivos(0) << "]\n";
+                break;
+            }
+                
+            case 29: { // Consultas por índice ordenado
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                int campo, tipo, ciudad;
+                ConsultaOrden consulta;
+                std::cout << "\n=== CONSULTAS POR ÍNDICE ORDENADO ===\n";
+                for (size_t c = 0; c < NUM_CAMPOS_ORDEN; ++c) {
+                    std::cout << c + 1 << ". " << nombreCampoOrden(static_cast<CampoOrden>(c)) << "\n";
+                }
+                std::cout << "Seleccione campo: ";
+                std::cin >> campo;
+                if (campo < 1 || campo > static_cast<int>(NUM_CAMPOS_ORDEN)) {
+                    std::cout << "Campo inválido\n";
+                    break;
+                }
+                if (!indicesOrden[campo - 1]) {
+                    std::cout << "El índice no está construido. Use opción 28 primero.\n";
+                    break;
+                }
+                
+                std::cout << "1. K mayores\n2. K menores\n3. Percentil\n4. Rango de valores\nSeleccione consulta: ";
+                std::cin >> tipo;
+                if (tipo < 1 || tipo > 4) {
+                    std::cout << "Consulta inválida\n";
+                    break;
+                }
+                consulta.tipo = static_cast<TipoConsultaOrden>(tipo - 1);
+                
+                std::cout << "Ciudad (0 = todas";
+                for (size_t c = 0; c < NUM_CIUDADES; ++c) std::cout << ", " << c + 1 << " = " << nombreCiudad(static_cast<CiudadId>(c));
+                std::cout << "): ";
+                std::cin >> ciudad;
+                if (ciudad < 0 || ciudad > static_cast<int>(NUM_CIUDADES)) {
+                    std::cout << "Ciudad inválida\n";
+                    break;
+                }
+                consulta.ciudad = (ciudad == 0) ? CIUDAD_INVALIDA : static_cast<CiudadId>(ciudad - 1);
+                
+                bool esFecha = campo - 1 == static_cast<int>(CampoOrden::FechaNacimiento);
+                if (consulta.tipo == TipoConsultaOrden::Percentil) {
+                    std::cout << "Percentil (0-100): ";
+                    std::cin >> consulta.percentil;
+                } else if (consulta.tipo == TipoConsultaOrden::Rango) {
+                    std::cout << (esFecha ? "Desde (AAAAMMDD): " : "Desde: ");
+                    std::cin >> consulta.desde;
+                    std::cout << (esFecha ? "Hasta (AAAAMMDD): " : "Hasta: ");
+                    std::cin >> consulta.hasta;
+                    std::cout << "Máximo de personas a listar: ";
+                    std::cin >> consulta.cantidad;
+                } else {
+                    std::cout << "K: ";
+                    std::cin >> consulta.cantidad;
+                }
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                consultarIndiceOrden(*personas, *indicesOrden[campo - 1], static_cast<CampoOrden>(campo - 1), consulta);
+                double tiempo_consulta = monitor.detener_tiempo();
+                monitor.registrar("Consulta índice ordenado", tiempo_consulta, monitor.obtener_memoria() - memoria_inicio);
+                std::cout << "Consulta en " << tiempo_consulta << " ms\n";
+                break;
+            }
+                
+            case 30: { // Distribución de riqueza
+                if (!hayPersonas()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                bool columnar = usarColumnar && store && !store->empty();
+                
+                // Con signo: leer "-1" en un size_t daría SIZE_MAX sin marcar error
+                long long kLeido;
+                char aproximado;
+                std::cout << "\nK (mayores patrimonios por ciudad): ";
+                if (!(std::cin >> kLeido) || kLeido <= 0) {
+                    std::cout << "Entrada inválida! K debe ser un entero positivo.\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                // Más de K filas que personas no cambia el resultado; acotar evita reservas enormes
+                size_t k = std::min(static_cast<size_t>(kLeido), personas->size());
+                std::cout << "¿Percentiles aproximados con boceto (error <= 1%)? (s/n): ";
+                std::cin >> aproximado;
+                
+                monitor.iniciar_tiempo(); // Sin contar el tiempo de lectura de la entrada
+                bool conBoceto = (aproximado == 's' || aproximado == 'S');
+                if (columnar) analizarDistribucionRiqueza(*personas, *store, k, conBoceto);
+                else analizarDistribucionRiqueza(objetos(), k, conBoceto);
+                
+                double tiempo_distribucion = monitor.detener_tiempo();
+                long memoria_distribucion = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(nombreOperacion("Distribución de riqueza", columnar), tiempo_distribucion,
+                                  memoria_distribucion);
+                std::cout << "\nDistribución en " << tiempo_distribucion << " ms [hilos: "
+                          << hilosEfectivos(0) << "]\n";
+                break;
+            }
+                
+            case 31: { // Microbenchmark de núcleos vectoriales
+                if (!store || store->empty()) {
+                    std::cout << "\nNo hay almacén columnar. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                int repeticiones;
+                std::cout << "\nRepeticiones por nivel (p. ej. 20): ";
+                std::cin >> repeticiones;
+                if (repeticiones < 1) {
+                    std::cout << "Número inválido!\n";
+                    break;
+                }
+                
+                double tiempo_nucleos = microbenchmarkVectorial(*store, repeticiones);
+                monitor.registrar("Microbenchmark vectorial", tiempo_nucleos, monitor.obtener_memoria() - memoria_inicio);
+                break;
+            }
+                
+            case 32: { // Comparar diseños de memoria
+                if (!hayPersonas() || !store) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                int repeticiones;
+                std::cout << "\nRepeticiones por análisis y diseño (p. ej. 5): ";
+                std::cin >> repeticiones;
+                if (repeticiones < 1) {
+                    std::cout << "Número inválido!\n";
+                    break;
+                }
+                
+                double tiempo_disenos = compararDisenos(objetos(), *store, repeticiones);
+                monitor.registrar("Comparar diseños", tiempo_disenos, monitor.obtener_memoria() - memoria_inicio);
+                break;
+            }
+                
+            default:
+                std::cout << "Opción inválida!\n";
+        }
+        
+        // Mostrar estadísticas de la operación
+        if (opcion >= 0 && opcion <= 8) {
+            double tiempo = monitor.detener_tiempo();
+            long memoria = monitor.obtener_memoria() - memoria_inicio;
+            monitor.mostrar_estadistica("Opción " + std::to_string(opcion), tiempo, memoria);
+        }
+        
+    } while(opcion != 11);
+    
+    return 0;
+}
\ No newline at end of file
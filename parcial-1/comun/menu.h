@@ -0,0 +1,17 @@
+#ifndef MENU_H
+#define MENU_H
+
+// --- Programa interactivo y benchmark no interactivo de las cuatro variantes ---
+//
+// menu.cpp no se compila una sola vez: cada variante lo compila con su propio persona.h
+// (el Makefile agrega -I. antes de la ruta de comun). Lo que cambia entre variantes
+// queda detrás de esa cabecera: Persona, AccesoPersona (analitica.h) y PasoPersona.
+
+/**
+ * Lee los argumentos y ejecuta el benchmark (--benchmark) o el menú principal.
+ *
+ * @return Código de salida del programa (0 si terminó bien).
+ */
+int ejecutarPrograma(int argc, char* argv[]);
+
+#endif // MENU_H
@@ -0,0 +1,414 @@
+#include "monitor.h"
+#include <unistd.h>       // sysconf
+#include <sys/resource.h> // getrusage
+#include <cstdio>         // FILE, fscanf
+#include <cstring>        // strncmp
+
+/**
+ * Inicia el cronómetro.
+ * 
+ * POR QUÉ: Comenzar a medir el tiempo de una operación.
+ * CÓMO: Guardando el tiempo actual en 'inicio' (steady_clock: monótono, no salta si
+ *       se ajusta la hora del sistema).
+ * PARA QUÉ: Poder calcular la duración después.
+ */
+void Monitor::iniciar_tiempo() {
+    inicio = std::chrono::steady_clock::now();
+}
+
+/**
+ * Detiene el cronómetro y devuelve el tiempo transcurrido.
+ * 
+ * POR QUÉ: Obtener la duración de una operación.
+ * CÓMO: Calculando la diferencia entre el tiempo actual y 'inicio'.
+ * PARA QUÉ: Conocer el tiempo que tomó una operación.
+ * @return Tiempo en milisegundos con decimales.
+ */
+double Monitor::detener_tiempo() {
+    auto fin = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> duracion = fin - inicio;
+    return duracion.count();
+}
+
+/**
+ * Obtiene la memoria residente actual (RSS) del proceso en KB.
+ * 
+ * POR QUÉ: Medir el consumo de memoria física.
+ * CÓMO: Leyendo el archivo /proc/self/statm (específico de Linux).
+ * PARA QUÉ: Monitorear el uso de memoria en operaciones críticas.
+ * @return Memoria residente en KB, o 0 en caso de error.
+ */
+long Monitor::obtener_memoria() {
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        perror("Error al abrir /proc/self/statm");
+        return 0;
+    }
+    
+    long size, resident, shared, text, lib, data, dt;
+    if (fscanf(file, "%ld %ld %ld %ld %ld %ld %ld", 
+              &size, &resident, &shared, &text, &lib, &data, &dt) != 7) {
+        fclose(file);
+        return 0;
+    }
+    
+    fclose(file);
+    
+    // Calcular memoria en KB: resident (páginas) * tamaño_página (KB)
+    long page_size_kb = sysconf(_SC_PAGESIZE) / 1024;
+    return resident * page_size_kb;
+}
+
+/**
+ * Obtiene la memoria residente máxima (pico) del proceso en KB.
+ * 
+ * POR QUÉ: obtener_memoria() solo ve el RSS en el momento de la llamada; los temporales
+ *          que una operación libera antes de terminar no aparecen.
+ * CÓMO: Leyendo VmHWM de /proc/self/status; si no está disponible, ru_maxrss de
+ *       getrusage (también en KB en Linux).
+ * PARA QUÉ: Conocer la memoria que realmente necesita el programa.
+ * @return Pico de memoria residente en KB, o 0 si no se puede obtener.
+ */
+long Monitor::obtener_memoria_pico() {
+    FILE* file = fopen("/proc/self/status", "r");
+    if (file) {
+        char linea[256];
+        long pico = -1;
+        while (fgets(linea, sizeof(linea), file)) {
+            if (strncmp(linea, "VmHWM:", 6) == 0) {
+                if (sscanf(linea + 6, "%ld", &pico) != 1) pico = -1;
+                break;
+            }
+        }
+        fclose(file);
+        if (pico >= 0) return pico;
+    }
+    
+    struct rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) != 0) return 0;
+    return uso.ru_maxrss;
+}
+
+/**
+ * Registra una operación con sus métricas de tiempo y memoria.
+ * 
+ * POR QUÉ: Almacenar estadísticas para análisis posterior.
+ * CÓMO: Guardando un nuevo Registro en el vector y actualizando acumulados; las fases
+ *       cerradas desde el registro anterior pasan a ser el desglose de la operación.
+ * PARA QUÉ: Tener un histórico de rendimiento.
+ */
+void Monitor::registrar(const std::string& operacion, double tiempo, long memoria) {
+    // Leer las asignaciones antes de que el propio registro asigne memoria
+    ConteoAsignaciones asignaciones = leerAsignaciones() - asignaciones_inicio;
+    long long pico_vivos = picoBytesVivos() - vivos_inicio;
+    agregar_fases(operacion, recogerFases());
+    registros.push_back({operacion, tiempo, memoria});
+    registros.back().asignaciones = asignaciones;
+    registros.back().pico_vivos = pico_vivos;
+    if (contadores.abiertos()) {
+        LecturaContadores lectura = contadores.leer();
+        registros.back().contadores = lectura - lectura_inicio;
+        lectura_inicio = lectura;
+    }
+    registros.back().registros = registros_conjunto;
+    reiniciar_asignaciones();
+    total_tiempo += tiempo;
+    if (memoria > max_memoria) {
+        max_memoria = memoria;
+    }
+}
+
+/**
+ * Empieza el desglose de la operación siguiente.
+ * 
+ * POR QUÉ: Lo que se ejecuta entre dos operaciones (p. ej. medir la arena de textos)
+ *          quedaría en el desglose y los contadores de la operación siguiente.
+ * CÓMO: Descartando las fases pendientes y tomando la lectura inicial de los contadores.
+ *       Cada registrar() continúa desde el anterior, así que varias operaciones seguidas
+ *       (p. ej. almacén columnar e índice de IDs) solo necesitan una llamada.
+ * PARA QUÉ: Llamarla al iniciar una operación para que su desglose empiece vacío.
+ * @param registros_conjunto Personas del conjunto (para los fallos por registro).
+ */
+void Monitor::iniciar_desglose(size_t registros_conjunto) {
+    recogerFases();
+    reiniciar_asignaciones();
+    if (contadores.abiertos()) lectura_inicio = contadores.leer();
+    this->registros_conjunto = registros_conjunto;
+}
+
+/**
+ * Activa los contadores de hardware para las operaciones siguientes.
+ * 
+ * POR QUÉ: perf_event_open puede no estar permitido (perf_event_paranoid, contenedores)
+ *          o no tener PMU (máquinas virtuales); el programa debe seguir funcionando.
+ * CÓMO: Abriendo cada evento por separado; los que fallan se informan en 'error'.
+ * @return false si no se pudo abrir ningún evento.
+ */
+bool Monitor::activar_contadores(std::string& error) {
+    bool abiertos = contadores.abrir(error);
+    if (abiertos) lectura_inicio = contadores.leer();
+    return abiertos;
+}
+
+/**
+ * Activa el seguimiento de memoria viva y muestra las asignaciones por operación.
+ * 
+ * POR QUÉ: El conteo de asignaciones siempre está activo, pero el pico de memoria viva
+ *          agrega un atomic compartido a cada new/delete; por eso es opcional.
+ * CÓMO: activarSeguimientoAsignaciones() y una marca para el resumen y el CSV.
+ * PARA QUÉ: Ver exactamente qué operaciones copian (p. ej. paso por valor) y comprobar
+ *           que los caminos sin copias hacen cero asignaciones.
+ */
+void Monitor::activar_asignaciones() {
+    activarSeguimientoAsignaciones();
+    con_asignaciones = true;
+    reiniciar_asignaciones();
+}
+
+// Punto de partida de las asignaciones de la operación siguiente
+void Monitor::reiniciar_asignaciones() {
+    asignaciones_inicio = leerAsignaciones();
+    vivos_inicio = bytesVivos();
+    reiniciarPicoBytesVivos();
+}
+
+/**
+ * Suma las fases de una ejecución al desglose de la operación.
+ * 
+ * POR QUÉ: Una opción que se repite (p. ej. un análisis) debe mostrar un solo árbol.
+ * CÓMO: Las fases se suman por ruta; las nuevas se insertan después de la última
+ *       fase de su padre, para conservar el orden de árbol.
+ */
+void Monitor::agregar_fases(const std::string& operacion, const std::vector<EstadisticaFase>& fases) {
+    if (fases.empty()) return;
+    Desglose* desglose = nullptr;
+    for (auto& existente : desgloses) {
+        if (existente.operacion == operacion) desglose = &existente;
+    }
+    if (!desglose) {
+        desgloses.push_back({operacion, fases});
+        return;
+    }
+    
+    std::vector<EstadisticaFase>& destino = desglose->fases;
+    for (const auto& fase : fases) {
+        // Fin del subárbol del padre (el padre ya está: las fases llegan en orden de árbol)
+        size_t posicion = destino.size();
+        size_t finPadre = destino.size();
+        std::string padre = (fase.nivel == 0) ? "" : fase.ruta.substr(0, fase.ruta.size() - fase.nombre.size() - 1);
+        for (size_t i = 0; i < destino.size(); ++i) {
+            if (destino[i].ruta == fase.ruta) posicion = i;
+            if (!padre.empty() && (destino[i].ruta == padre || destino[i].ruta.compare(0, padre.size() + 1, padre + "/") == 0)) {
+                finPadre = i + 1;
+            }
+        }
+        if (posicion < destino.size()) {
+            destino[posicion].llamadas += fase.llamadas;
+            destino[posicion].ms += fase.ms;
+            destino[posicion].variosHilos = destino[posicion].variosHilos || fase.variosHilos;
+        } else {
+            destino.insert(destino.begin() + static_cast<std::ptrdiff_t>(finPadre), fase);
+        }
+    }
+}
+
+/**
+ * Registra memoria ahorrada por una optimización.
+ * 
+ * POR QUÉ: Algunas mejoras (como la arena de textos) no se ven en una operación puntual,
+ *          sino en la memoria que el conjunto deja de ocupar.
+ * CÓMO: Guardando el concepto y los KB aparte de las operaciones.
+ * PARA QUÉ: Mostrarlos en el resumen junto a la memoria máxima.
+ */
+void Monitor::registrar_ahorro(const std::string& concepto, long memoria) {
+    ahorros.push_back({concepto, 0, memoria});
+}
+
+/**
+ * Registra la memoria que ocupa una estructura auxiliar (p. ej. un índice).
+ * 
+ * POR QUÉ: Los índices opcionales cambian tiempo de consulta por memoria; hay que ver cuánta.
+ * CÓMO: Una entrada por estructura: reconstruirla reemplaza su valor y 0 la quita.
+ * PARA QUÉ: Mostrar en el resumen la memoria de las estructuras vigentes.
+ */
+void Monitor::registrar_estructura(const std::string& estructura, long memoria) {
+    for (auto it = estructuras.begin(); it != estructuras.end(); ++it) {
+        if (it->operacion == estructura) {
+            estructuras.erase(it);
+            break;
+        }
+    }
+    if (memoria > 0) estructuras.push_back({estructura, 0, memoria});
+}
+
+/**
+ * Muestra las estadísticas de una operación.
+ * 
+ * POR QUÉ: Feedback inmediato al usuario.
+ * CÓMO: Imprimiendo en consola.
+ * PARA QUÉ: Visualizar el rendimiento de una operación concreta.
+ */
+void Monitor::mostrar_estadistica(const std::string& operacion, double tiempo, long memoria) {
+    std::cout << "\n[ESTADÍSTICAS] " << operacion << " - "
+              << "Tiempo: " << tiempo << " ms, "
+              << "Memoria: " << memoria << " KB\n";
+}
+
+// Instrucciones por ciclo de una lectura; false si falta alguno de los dos contadores
+static bool calcular_ipc(const LecturaContadores& lectura, double& ipc) {
+    if (!lectura.valido(EventoHardware::Ciclos) || !lectura.valido(EventoHardware::Instrucciones)) return false;
+    uint64_t ciclos = lectura.valor(EventoHardware::Ciclos);
+    ipc = (ciclos > 0) ? static_cast<double>(lectura.valor(EventoHardware::Instrucciones)) / ciclos : 0;
+    return true;
+}
+
+// Eventos por registro; false si el evento no está disponible o no hay registros
+static bool calcular_por_registro(const LecturaContadores& lectura, EventoHardware evento, size_t registros,
+                                  double& porRegistro) {
+    if (!lectura.valido(evento) || registros == 0) return false;
+    porRegistro = static_cast<double>(lectura.valor(evento)) / registros;
+    return true;
+}
+
+// Escribe los eventos por registro (o el total si no hay registros), o "n/d"
+static void mostrar_por_registro(const LecturaContadores& lectura, EventoHardware evento, size_t registros) {
+    double porRegistro;
+    if (!lectura.valido(evento)) {
+        std::cout << "n/d";
+    } else if (!calcular_por_registro(lectura, evento, registros, porRegistro)) {
+        std::cout << lectura.valor(evento);
+    } else {
+        std::cout << porRegistro << "/reg";
+    }
+}
+
+// Eventos por registro que muestra el resumen y exporta el CSV
+static const EventoHardware EVENTOS_POR_REGISTRO[] = {
+    EventoHardware::FallosL1, EventoHardware::FallosLLC, EventoHardware::FallosSalto
+};
+
+/**
+ * Muestra un resumen de todas las estadísticas registradas.
+ * 
+ * POR QUÉ: Proporcionar una visión global del rendimiento.
+ * CÓMO: Iterando sobre todos los registros e imprimiéndolos.
+ * PARA QUÉ: Análisis comparativo de diferentes operaciones.
+ */
+void Monitor::mostrar_resumen() {
+    std::cout << "\n=== RESUMEN DE ESTADÍSTICAS ===";
+    for (const auto& reg : registros) {
+        std::cout << "\n" << reg.operacion << ": "
+                  << reg.tiempo << " ms, " << reg.memoria << " KB";
+    }
+    std::cout << "\nTotal tiempo: " << total_tiempo << " ms";
+    std::cout << "\nMemoria máxima: " << max_memoria << " KB";
+    std::cout << "\nMemoria pico del proceso (VmHWM): " << obtener_memoria_pico() << " KB";
+    for (const auto& ahorro : ahorros) {
+        std::cout << "\nMemoria ahorrada (" << ahorro.operacion << "): " << ahorro.memoria << " KB";
+    }
+    for (const auto& estructura : estructuras) {
+        std::cout << "\nMemoria de " << estructura.operacion << ": " << estructura.memoria << " KB";
+    }
+    
+    if (contadores.abiertos()) {
+        std::cout << "\n\n--- Contadores de hardware (por persona del conjunto; n/d = no disponible) ---";
+        for (const auto& reg : registros) {
+            double ipc;
+            std::cout << "\n" << reg.operacion << ": IPC ";
+            if (calcular_ipc(reg.contadores, ipc)) std::cout << ipc;
+            else std::cout << "n/d";
+            std::cout << ", fallos L1 ";
+            mostrar_por_registro(reg.contadores, EventoHardware::FallosL1, reg.registros);
+            std::cout << ", fallos LLC ";
+            mostrar_por_registro(reg.contadores, EventoHardware::FallosLLC, reg.registros);
+            std::cout << ", saltos mal predichos ";
+            mostrar_por_registro(reg.contadores, EventoHardware::FallosSalto, reg.registros);
+            std::cout << ", fallos de página ";
+            if (reg.contadores.valido(EventoHardware::FallosPagina)) std::cout << reg.contadores.valor(EventoHardware::FallosPagina);
+            else std::cout << "n/d";
+        }
+    }
+    
+    if (con_asignaciones) {
+        std::cout << "\n\n--- Asignaciones dinámicas por operación (pico vivo: sobre la memoria al empezar) ---";
+        for (const auto& reg : registros) {
+            std::cout << "\n" << reg.operacion << ": " << reg.asignaciones.asignaciones << " asignaciones ("
+                      << reg.asignaciones.bytes / 1024 << " KB), " << reg.asignaciones.liberaciones
+                      << " liberaciones, pico vivo " << (reg.pico_vivos > 0 ? reg.pico_vivos / 1024 : 0) << " KB";
+        }
+    }
+    
+    if (!desgloses.empty()) {
+        // Las fases de hilos trabajadores suman el tiempo de todos los hilos: pueden superar al padre
+        std::cout << "\n\n--- Desglose por fases (* = suma de varios hilos) ---";
+        uint64_t numFases = 0;
+        for (const auto& desglose : desgloses) {
+            std::cout << "\n" << desglose.operacion;
+            for (const auto& fase : desglose.fases) {
+                std::cout << "\n" << std::string(2 * (fase.nivel + 1), ' ') << fase.nombre
+                          << (fase.variosHilos ? "*" : "") << ": " << fase.ms << " ms ("
+                          << fase.llamadas << (fase.llamadas == 1 ? " vez)" : " veces)");
+                numFases += fase.llamadas;
+            }
+        }
+        double sobrecosto = static_cast<double>(numFases) * costoFaseNs() / 1e6;
+        std::cout << "\nFases medidas: " << numFases << ", costo estimado de medirlas: " << sobrecosto << " ms";
+        if (total_tiempo > 0) {
+            std::streamsize precision = std::cout.precision(3);
+            std::cout << " (" << 100.0 * sobrecosto / total_tiempo << "% del total)";
+            std::cout.precision(precision);
+        }
+    }
+    std::cout << "\n";
+}
+
+/**
+ * Exporta las estadísticas a un archivo CSV.
+ * 
+ * POR QUÉ: Permitir análisis con herramientas externas (Excel, Python, etc.).
+ * CÓMO: Escribiendo en un archivo de texto con formato CSV.
+ * PARA QUÉ: Generar reportes y gráficos.
+ * @param nombre_archivo Nombre del archivo CSV (por defecto "estadisticas.csv")
+ */
+void Monitor::exportar_csv(const std::string& nombre_archivo) {
+    std::ofstream archivo(nombre_archivo);
+    if (!archivo) {
+        std::cerr << "Error al abrir archivo: " << nombre_archivo << std::endl;
+        return;
+    }
+    // Con contadores de hardware o asignaciones se agregan sus columnas (los eventos no
+    // disponibles, y los valores por registro de operaciones sin registros, quedan vacíos)
+    bool conContadores = contadores.abiertos();
+    archivo << "Operacion,Tiempo(ms),Memoria(KB)";
+    if (conContadores) {
+        for (size_t e = 0; e < NUM_EVENTOS_HARDWARE; ++e) archivo << "," << nombreEventoHardware(static_cast<EventoHardware>(e));
+        archivo << ",Registros,IPC";
+        for (EventoHardware evento : EVENTOS_POR_REGISTRO) archivo << "," << nombreEventoHardware(evento) << "PorRegistro";
+    }
+    if (con_asignaciones) archivo << ",Asignaciones,BytesAsignados,Liberaciones,PicoVivo(KB)";
+    archivo << "\n";
+    for (const auto& reg : registros) {
+        archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria;
+        if (conContadores) {
+            for (size_t e = 0; e < NUM_EVENTOS_HARDWARE; ++e) {
+                archivo << ",";
+                if (reg.contadores.validos[e]) archivo << reg.contadores.valores[e];
+            }
+            archivo << "," << reg.registros << ",";
+            double ipc;
+            if (calcular_ipc(reg.contadores, ipc)) archivo << ipc;
+            for (EventoHardware evento : EVENTOS_POR_REGISTRO) {
+                double porRegistro;
+                archivo << ",";
+                if (calcular_por_registro(reg.contadores, evento, reg.registros, porRegistro)) archivo << porRegistro;
+            }
+        }
+        if (con_asignaciones) {
+            archivo << "," << reg.asignaciones.asignaciones << "," << reg.asignaciones.bytes << ","
+                    << reg.asignaciones.liberaciones << "," << (reg.pico_vivos > 0 ? reg.pico_vivos / 1024 : 0);
+        }
+        archivo << "\n";
+    }
+    archivo.close();
+    std::cout << "Estadísticas exportadas a " << nombre_archivo << "\n";
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef MONITOR_H
+#define MONITOR_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include "perfilador.h"
+#include "contadores_hardware.h"
+#include "contador_asignaciones.h"
+
+/**
+ * Clase para monitorear el rendimiento (tiempo y memoria).
+ * 
+ * POR QUÉ: Cuantificar el rendimiento de las operaciones.
+ * CÓMO: Midiendo tiempo con steady_clock y memoria con /proc/self/statm y
+ *       /proc/self/status (Linux). Cada operación registrada se lleva las fases
+ *       (perfilador.h) cerradas desde la anterior, como su desglose, y, si se activaron,
+ *       los contadores de hardware (contadores_hardware.h) y las asignaciones de
+ *       memoria (contador_asignaciones.h) del mismo intervalo.
+ * PARA QUÉ: Optimización y análisis de rendimiento. Las cuatro variantes comparten
+ *           esta clase, así que sus mediciones son comparables.
+ */
+class Monitor {
+public:
+    void iniciar_tiempo();
+    double detener_tiempo();
+    long obtener_memoria();
+    long obtener_memoria_pico();
+    
+    void registrar(const std::string& operacion, double tiempo, long memoria);
+    void iniciar_desglose(size_t registros_conjunto);
+    bool activar_contadores(std::string& error);
+    void activar_asignaciones();
+    void registrar_ahorro(const std::string& concepto, long memoria);
+    void registrar_estructura(const std::string& estructura, long memoria);
+    void mostrar_estadistica(const std::string& operacion, double tiempo, long memoria);
+    void mostrar_resumen();
+    void exportar_csv(const std::string& nombre_archivo = "estadisticas.csv");
+
+private:
+    // Estructura para almacenar métricas de una operación
+    struct Registro {
+        Registro(const std::string& operacion, double tiempo, long memoria)
+            : operacion(operacion), tiempo(tiempo), memoria(memoria) {}
+        
+        std::string operacion; // Nombre de la operación
+        double tiempo;         // Tiempo en milisegundos
+        long memoria;          // Memoria en KB
+        LecturaContadores contadores; // Eventos de hardware de la operación
+        size_t registros = 0;  // Personas del conjunto durante la operación
+        ConteoAsignaciones asignaciones; // Asignaciones dinámicas de la operación
+        long long pico_vivos = 0; // Pico de bytes vivos sobre los del inicio (con seguimiento)
+    };
+    
+    // Desglose en fases de una operación (acumulado si se repite)
+    struct Desglose {
+        std::string operacion;
+        std::vector<EstadisticaFase> fases;
+    };
+    
+    void agregar_fases(const std::string& operacion, const std::vector<EstadisticaFase>& fases);
+    void reiniciar_asignaciones();
+    
+    std::chrono::steady_clock::time_point inicio; // Punto de inicio del cronómetro
+    std::vector<Registro> registros; // Historial de registros
+    std::vector<Registro> ahorros;   // Memoria ahorrada por optimizaciones (tiempo sin usar)
+    std::vector<Registro> estructuras; // Memoria actual de estructuras auxiliares (tiempo sin usar)
+    std::vector<Desglose> desgloses; // Fases de cada operación, en orden de primera aparición
+    double total_tiempo = 0;         // Tiempo total acumulado
+    long max_memoria = 0;            // Máximo de memoria utilizado
+    ContadoresHardware contadores;   // Cerrados salvo que se llame a activar_contadores
+    LecturaContadores lectura_inicio; // Contadores al empezar la operación actual
+    size_t registros_conjunto = 0;   // Personas del conjunto en la operación actual
+    bool con_asignaciones = false;   // Mostrar y exportar las asignaciones por operación
+    ConteoAsignaciones asignaciones_inicio; // Contador de asignaciones al empezar la operación
+    long long vivos_inicio = 0;      // Bytes vivos al empezar la operación
+};
+
+#endif // MONITOR_H
\ No newline at end of file
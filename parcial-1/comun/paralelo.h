@@ -0,0 +1,119 @@
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "perfilador.h"
+
+// Número de hilos de hardware (al menos 1)
+inline unsigned hilosDisponibles() {
+    unsigned hilos = std::thread::hardware_concurrency();
+    return hilos == 0 ? 1 : hilos;
+}
+
+// Hilos a usar cuando una operación recibe hilos = 0 (0 = todos los disponibles);
+// se cambia con --hilos para medir la escalabilidad
+inline unsigned& hilosPorDefecto() {
+    static unsigned hilos = 0;
+    return hilos;
+}
+
+// Número real de hilos para una petición (0 = valor por defecto)
+inline unsigned hilosEfectivos(unsigned hilos) {
+    if (hilos == 0) hilos = hilosPorDefecto();
+    return hilos == 0 ? hilosDisponibles() : hilos;
+}
+
+/**
+ * Reparte un rango [0, total) en bloques de tamaño fijo entre varios hilos.
+ *
+ * POR QUÉ: Aprovechar todos los núcleos sin que el resultado dependa del número de hilos.
+ * CÓMO: Los bloques se toman de un contador atómico; el contenido de cada bloque solo
+ *       depende de su número, no del hilo que lo procesa. El hilo que llama también trabaja.
+ *       Las fases (perfilador.h) que abran los trabajadores cuelgan de la fase del que llama.
+ * PARA QUÉ: Generación y análisis paralelos y deterministas.
+ *
+ * @param hilos Hilos a usar (0 = hilosPorDefecto()).
+ * @param tarea Se invoca como tarea(bloque, inicio, fin) para cada bloque.
+ */
+template <typename Tarea>
+void paraCadaBloque(size_t total, size_t tamBloque, unsigned hilos, Tarea tarea) {
+    if (total == 0) return;
+    size_t numBloques = (total + tamBloque - 1) / tamBloque;
+    hilos = hilosEfectivos(hilos);
+    if (hilos > numBloques) hilos = static_cast<unsigned>(numBloques);
+
+    std::atomic<size_t> siguiente(0);
+    auto trabajador = [&]() {
+        for (size_t b = siguiente.fetch_add(1); b < numBloques; b = siguiente.fetch_add(1)) {
+            size_t inicio = b * tamBloque;
+            tarea(b, inicio, std::min(total, inicio + tamBloque));
+        }
+    };
+
+    RutaFase fase = rutaFaseActual();
+    std::vector<std::thread> trabajadores;
+    for (unsigned i = 1; i < hilos; ++i) {
+        trabajadores.emplace_back([&]() {
+            FaseHeredada herencia(fase);
+            trabajador();
+        });
+    }
+    trabajador();
+    for (auto& t : trabajadores) t.join();
+}
+
+// Filas por bloque en las reducciones (fijo: el resultado no depende del número de hilos)
+const size_t BLOQUE_REDUCCION = 65536;
+
+/**
+ * Igual que reducirPorBloques (abajo), pero combina los parciales sobre un acumulador existente.
+ *
+ * POR QUÉ: En el procesamiento por lotes cada lote continúa la reducción de los anteriores.
+ * CÓMO: combinar(resultado, parcial) con los parciales de este rango en orden de bloque.
+ *       Se mide como la fase "recorrido", con una subfase "bloque" por bloque.
+ *       Si cada lote tiene un número entero de bloques, el resultado (incluidas las sumas
+ *       de punto flotante) es idéntico al de una sola reducción sobre todas las filas.
+ */
+template <typename Acumulador, typename Acumular, typename Combinar>
+void reducirPorBloquesSobre(Acumulador& resultado, size_t total, const Acumulador& inicial,
+                            Acumular acumular, Combinar combinar, unsigned hilos = 0) {
+    size_t numBloques = (total + BLOQUE_REDUCCION - 1) / BLOQUE_REDUCCION;
+    std::vector<Acumulador> parciales(numBloques, inicial);
+
+    Fase fase("recorrido");
+    paraCadaBloque(total, BLOQUE_REDUCCION, hilos, [&](size_t bloque, size_t inicio, size_t fin) {
+        Fase faseBloque("bloque");
+        Acumulador local = inicial; // Copia local: evita compartir líneas de caché entre hilos
+        acumular(local, inicio, fin);
+        parciales[bloque] = local;
+    });
+
+    for (const auto& parcial : parciales) combinar(resultado, parcial);
+}
+
+/**
+ * Agrupación y reducción paralela (map-reduce) sobre las filas [0, total).
+ *
+ * POR QUÉ: Los análisis por grupo (ciudad, calendario DIAN) son recorridos completos que
+ *          solo actualizan unos pocos acumuladores; se pueden repartir entre núcleos.
+ * CÓMO: Cada bloque de BLOQUE_REDUCCION filas acumula en su propia copia de 'inicial'
+ *       (sin compartir memoria entre hilos); al final las copias se combinan en orden de
+ *       bloque, así que sumas y desempates ("gana la primera fila") no dependen de los hilos.
+ * PARA QUÉ: Que todos los análisis por grupo escalen con el número de núcleos.
+ *
+ * @param acumular Se invoca como acumular(acumulador, inicio, fin) para cada bloque.
+ * @param combinar Se invoca como combinar(total, parcial), con los parciales en orden de bloque.
+ */
+template <typename Acumulador, typename Acumular, typename Combinar>
+Acumulador reducirPorBloques(size_t total, const Acumulador& inicial, Acumular acumular,
+                             Combinar combinar, unsigned hilos = 0) {
+    Acumulador resultado = inicial;
+    reducirPorBloquesSobre(resultado, total, inicial, acumular, combinar, hilos);
+    return resultado;
+}
+
+#endif // PARALELO_H
@@ -0,0 +1,223 @@
+#include "perfilador.h"
+#include <map>
+#include <mutex>
+#include <utility>
+
+struct BufferFases;
+
+// Ruta de fases conocida: su padre y su último nombre
+struct NodoRuta {
+    RutaFase padre;
+    std::string nombre;
+};
+
+/**
+ * Estado compartido del perfilador.
+ *
+ * CÓMO: Las rutas se numeran la primera vez que algún hilo las abre (un hijo siempre
+ *       tiene un número mayor que su padre). Los contadores no están aquí sino en el
+ *       búfer de cada hilo; cuando un hilo termina, los suyos se suman a 'retiradas'.
+ */
+struct RegistroFases {
+    std::mutex cerrojo;
+    std::vector<NodoRuta> rutas{{0, ""}};  // rutas[0]: raíz
+    std::map<std::pair<RutaFase, std::string>, RutaFase> porNombre;
+    std::vector<BufferFases*> vivos;       // Búferes de los hilos en ejecución
+    std::vector<uint64_t> llamadasRetiradas;
+    std::vector<uint64_t> nanosRetirados;
+};
+
+static RegistroFases& registro() {
+    static RegistroFases estado;
+    return estado;
+}
+
+/**
+ * Contadores de un hilo, por ruta.
+ *
+ * POR QUÉ: Con contadores compartidos, cada fase cerrada en un hilo trabajador sería una
+ *          escritura atómica sobre una línea de caché disputada.
+ * CÓMO: Vectores indexados por RutaFase que solo escribe su hilo, y una caché local
+ *       (padre, dirección del nombre) -> ruta para no tomar el cerrojo al abrir una fase.
+ */
+struct BufferFases {
+    std::vector<uint64_t> llamadas;
+    std::vector<uint64_t> nanos;
+    std::map<std::pair<RutaFase, const char*>, RutaFase> conocidas;
+
+    BufferFases() {
+        std::lock_guard<std::mutex> guardia(registro().cerrojo);
+        registro().vivos.push_back(this);
+    }
+
+    ~BufferFases() {
+        RegistroFases& estado = registro();
+        std::lock_guard<std::mutex> guardia(estado.cerrojo);
+        if (estado.llamadasRetiradas.size() < llamadas.size()) {
+            estado.llamadasRetiradas.resize(llamadas.size(), 0);
+            estado.nanosRetirados.resize(llamadas.size(), 0);
+        }
+        for (size_t r = 0; r < llamadas.size(); ++r) {
+            estado.llamadasRetiradas[r] += llamadas[r];
+            estado.nanosRetirados[r] += nanos[r];
+        }
+        for (size_t i = 0; i < estado.vivos.size(); ++i) {
+            if (estado.vivos[i] == this) {
+                estado.vivos.erase(estado.vivos.begin() + static_cast<std::ptrdiff_t>(i));
+                break;
+            }
+        }
+    }
+
+    // Ruta de la fase 'nombre' abierta dentro de 'padre' (la registra si es nueva)
+    RutaFase ruta(RutaFase padre, const char* nombre) {
+        auto clave = std::make_pair(padre, nombre);
+        auto conocida = conocidas.find(clave);
+        if (conocida != conocidas.end()) return conocida->second;
+
+        RutaFase ruta;
+        {
+            RegistroFases& estado = registro();
+            std::lock_guard<std::mutex> guardia(estado.cerrojo);
+            auto existente = estado.porNombre.find(std::make_pair(padre, std::string(nombre)));
+            if (existente != estado.porNombre.end()) {
+                ruta = existente->second;
+            } else {
+                ruta = static_cast<RutaFase>(estado.rutas.size());
+                estado.rutas.push_back({padre, nombre});
+                estado.porNombre.emplace(std::make_pair(padre, std::string(nombre)), ruta);
+            }
+        }
+        conocidas.emplace(clave, ruta);
+        if (llamadas.size() <= ruta) {
+            llamadas.resize(ruta + 1, 0);
+            nanos.resize(ruta + 1, 0);
+        }
+        return ruta;
+    }
+};
+
+static thread_local RutaFase faseActual = 0;
+
+static BufferFases& bufferHilo() {
+    static thread_local BufferFases buffer;
+    return buffer;
+}
+
+RutaFase rutaFaseActual() {
+    return faseActual;
+}
+
+Fase::Fase(const char* nombre) : ruta(bufferHilo().ruta(faseActual, nombre)), anterior(faseActual) {
+    faseActual = ruta;
+    inicio = std::chrono::steady_clock::now();
+}
+
+Fase::~Fase() {
+    auto duracion = std::chrono::steady_clock::now() - inicio;
+    BufferFases& buffer = bufferHilo();
+    buffer.llamadas[ruta]++;
+    buffer.nanos[ruta] += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duracion).count());
+    faseActual = anterior;
+}
+
+FaseHeredada::FaseHeredada(RutaFase padre) : anterior(faseActual) {
+    faseActual = padre;
+}
+
+FaseHeredada::~FaseHeredada() {
+    faseActual = anterior;
+}
+
+// Agrega 'ruta' y sus descendientes con llamadas a 'salida', en orden de árbol
+static void recorrerArbol(RutaFase ruta, int nivel, const std::string& prefijo,
+                          const std::vector<NodoRuta>& rutas, const std::vector<std::vector<RutaFase>>& hijos,
+                          const std::vector<bool>& activa, const std::vector<uint64_t>& llamadas,
+                          const std::vector<uint64_t>& nanos, const std::vector<bool>& variosHilos,
+                          std::vector<EstadisticaFase>& salida) {
+    for (RutaFase hijo : hijos[ruta]) {
+        if (!activa[hijo]) continue;
+        EstadisticaFase fase;
+        fase.nombre = rutas[hijo].nombre;
+        fase.ruta = prefijo.empty() ? fase.nombre : prefijo + "/" + fase.nombre;
+        fase.nivel = nivel;
+        fase.llamadas = llamadas[hijo];
+        fase.ms = static_cast<double>(nanos[hijo]) / 1e6;
+        fase.variosHilos = variosHilos[hijo];
+        salida.push_back(fase);
+        recorrerArbol(hijo, nivel + 1, fase.ruta, rutas, hijos, activa, llamadas, nanos, variosHilos, salida);
+    }
+}
+
+/**
+ * Implementación de recogerFases.
+ *
+ * CÓMO: Suma los contadores de los búferes vivos y de los hilos ya terminados, los pone
+ *       en cero y arma el árbol desde la raíz; una ruta sin llamadas se incluye solo si
+ *       algún descendiente tiene.
+ */
+std::vector<EstadisticaFase> recogerFases() {
+    BufferFases* propio = &bufferHilo();  // Antes del cerrojo: crearlo lo toma
+    RegistroFases& estado = registro();
+    std::lock_guard<std::mutex> guardia(estado.cerrojo);
+
+    size_t numRutas = estado.rutas.size();
+    std::vector<uint64_t> llamadas(numRutas, 0), nanos(numRutas, 0);
+    std::vector<bool> variosHilos(numRutas, false);
+    for (BufferFases* buffer : estado.vivos) {
+        for (size_t r = 0; r < buffer->llamadas.size(); ++r) {
+            if (buffer->llamadas[r] == 0) continue;
+            llamadas[r] += buffer->llamadas[r];
+            nanos[r] += buffer->nanos[r];
+            if (buffer != propio) variosHilos[r] = true;
+            buffer->llamadas[r] = 0;
+            buffer->nanos[r] = 0;
+        }
+    }
+    for (size_t r = 0; r < estado.llamadasRetiradas.size(); ++r) {
+        if (estado.llamadasRetiradas[r] == 0) continue;
+        llamadas[r] += estado.llamadasRetiradas[r];
+        nanos[r] += estado.nanosRetirados[r];
+        variosHilos[r] = true;
+        estado.llamadasRetiradas[r] = 0;
+        estado.nanosRetirados[r] = 0;
+    }
+
+    // Los hijos tienen número mayor que su padre: un recorrido descendente marca a los ancestros
+    std::vector<bool> activa(numRutas, false);
+    std::vector<std::vector<RutaFase>> hijos(numRutas);
+    for (size_t r = numRutas; r-- > 1;) {
+        if (llamadas[r] > 0) activa[r] = true;
+        if (activa[r]) activa[estado.rutas[r].padre] = true;
+    }
+    for (size_t r = 1; r < numRutas; ++r) hijos[estado.rutas[r].padre].push_back(static_cast<RutaFase>(r));
+
+    std::vector<EstadisticaFase> salida;
+    recorrerArbol(0, 0, "", estado.rutas, hijos, activa, llamadas, nanos, variosHilos, salida);
+    return salida;
+}
+
+/**
+ * Implementación de costoFaseNs.
+ *
+ * CÓMO: Abre y cierra REPETICIONES fases vacías y divide el tiempo; después borra sus
+ *       contadores para que no aparezcan en el desglose.
+ */
+double costoFaseNs() {
+    static const double costo = [] {
+        static const char* const CALIBRACION = "calibración";
+        const int REPETICIONES = 10000;
+        auto inicio = std::chrono::steady_clock::now();
+        for (int i = 0; i < REPETICIONES; ++i) {
+            Fase fase(CALIBRACION);
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - inicio).count();
+
+        BufferFases& buffer = bufferHilo();
+        RutaFase ruta = buffer.ruta(faseActual, CALIBRACION);
+        buffer.llamadas[ruta] = 0;
+        buffer.nanos[ruta] = 0;
+        return ns / REPETICIONES;
+    }();
+    return costo;
+}
@@ -0,0 +1,85 @@
+#ifndef PERFILADOR_H
+#define PERFILADOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// --- Perfilador jerárquico: fases anidadas medidas con objetos RAII ---
+
+// Identificador de una ruta de fases ("generación/bloque"); 0 = ninguna fase abierta
+using RutaFase = uint32_t;
+
+// Fase abierta más interna del hilo actual (0 si no hay ninguna)
+RutaFase rutaFaseActual();
+
+/**
+ * Fase medida mientras exista el objeto.
+ *
+ * POR QUÉ: El Monitor da un solo tiempo por opción del menú; no dice si el costo está en
+ *          la generación, en la construcción de índices, en el recorrido o en la salida.
+ * CÓMO: El constructor toma el tiempo (steady_clock) y el destructor suma la duración a
+ *       la ruta de la fase (padre + nombre) en el búfer del hilo, sin cerrojos: cada hilo
+ *       tiene sus propios contadores por ruta. Las fases se anidan con el alcance de C++.
+ * PARA QUÉ: Desglosar cada operación en subfases con un costo de unas decenas de
+ *           nanosegundos por fase (usarlas por bloque o por etapa, no por fila).
+ *
+ * @param nombre Literal de texto: se usa su dirección para reconocer la fase.
+ */
+class Fase {
+public:
+    explicit Fase(const char* nombre);
+    ~Fase();
+
+    Fase(const Fase&) = delete;
+    Fase& operator=(const Fase&) = delete;
+
+private:
+    RutaFase ruta;
+    RutaFase anterior;  // Fase abierta antes de esta (se restaura al cerrarla)
+    std::chrono::steady_clock::time_point inicio;
+};
+
+/**
+ * Hace que las fases de un hilo trabajador cuelguen de la fase que lanzó el trabajo.
+ *
+ * POR QUÉ: Un hilo nuevo no tiene fases abiertas; sin esto sus fases quedarían en la raíz.
+ * CÓMO: Cambia la fase actual del hilo a 'padre' y la restaura al destruirse.
+ */
+class FaseHeredada {
+public:
+    explicit FaseHeredada(RutaFase padre);
+    ~FaseHeredada();
+
+    FaseHeredada(const FaseHeredada&) = delete;
+    FaseHeredada& operator=(const FaseHeredada&) = delete;
+
+private:
+    RutaFase anterior;
+};
+
+/**
+ * Tiempo acumulado de una ruta de fases.
+ */
+struct EstadisticaFase {
+    std::string ruta;         // Nombres desde la raíz separados por '/'
+    std::string nombre;       // Último nombre de la ruta
+    int nivel = 0;            // 0 = fase de primer nivel
+    uint64_t llamadas = 0;
+    double ms = 0;            // Suma de las duraciones (de todos los hilos)
+    bool variosHilos = false; // La ejecutó algún hilo distinto del que recoge
+};
+
+/**
+ * Fases cerradas desde la última llamada, en orden de árbol (cada fase justo después de
+ * su padre), y reinicia los contadores de todos los hilos.
+ *
+ * Debe llamarse sin trabajo paralelo en curso (entre operaciones).
+ */
+std::vector<EstadisticaFase> recogerFases();
+
+// Costo de abrir y cerrar una fase en este proceso, en nanosegundos (medido la primera vez)
+double costoFaseNs();
+
+#endif // PERFILADOR_H
@@ -0,0 +1,179 @@
+#include "persona_store.h"
+#include "analitica.h" // Recorridos escalares compartidos con las variantes de objetos
+#include "paralelo.h" // reducirPorBloques, reducirPorBloquesSobre
+#include "vectorial.h" // Núcleos SSE2/AVX2 de los recorridos por bloque
+#include <algorithm>  // std::sort
+
+void PersonaStore::reserve(size_t n) {
+    patrimonio.reserve(n);
+    ingresosAnuales.reserve(n);
+    deudas.reserve(n);
+    declaranteRenta.reserve(n);
+    ciudad.reserve(n);
+    anioNacimiento.reserve(n);
+    grupoDIAN.reserve(n);
+    id.reserve(n);
+}
+
+void PersonaStore::agregar(uint64_t idPersona, double ingresos, double patri, double deud, bool declara,
+                           CiudadId ciudadId, uint16_t anio, char grupo) {
+    ingresosAnuales.push_back(ingresos);
+    patrimonio.push_back(patri);
+    deudas.push_back(deud);
+    declaranteRenta.push_back(declara ? 1 : 0);
+    ciudad.push_back(ciudadId);
+    anioNacimiento.push_back(anio);
+    grupoDIAN.push_back(grupo);
+    id.push_back(idPersona);
+}
+
+void PersonaStore::hacerPropio() {
+    patrimonio.hacerPropia();
+    ingresosAnuales.hacerPropia();
+    deudas.hacerPropia();
+    declaranteRenta.hacerPropia();
+    ciudad.hacerPropia();
+    anioNacimiento.hacerPropia();
+    grupoDIAN.hacerPropia();
+    id.hacerPropia();
+    respaldo.reset();
+}
+
+void PersonaStore::asignarFila(size_t fila, uint64_t idPersona, double ingresos, double patri, double deud,
+                               bool declara, CiudadId ciudadId, uint16_t anio, char grupo) {
+    ingresosAnuales.asignar(fila, ingresos);
+    patrimonio.asignar(fila, patri);
+    deudas.asignar(fila, deud);
+    declaranteRenta.asignar(fila, declara ? 1 : 0);
+    ciudad.asignar(fila, ciudadId);
+    anioNacimiento.asignar(fila, anio);
+    grupoDIAN.asignar(fila, grupo);
+    id.asignar(fila, idPersona);
+}
+
+void PersonaStore::quitarFila(size_t fila) {
+    size_t ultima = size() - 1;
+    if (fila != ultima) {
+        asignarFila(fila, id[ultima], ingresosAnuales[ultima], patrimonio[ultima], deudas[ultima],
+                    declaranteRenta[ultima] != 0, ciudad[ultima], anioNacimiento[ultima], grupoDIAN[ultima]);
+    }
+    ingresosAnuales.pop_back();
+    patrimonio.pop_back();
+    deudas.pop_back();
+    declaranteRenta.pop_back();
+    ciudad.pop_back();
+    anioNacimiento.pop_back();
+    grupoDIAN.pop_back();
+    id.pop_back();
+}
+
+// Recorridos escalares sobre las columnas (los que tienen núcleo vectorial van aparte)
+using AnalisisColumnar = Analitica<AccesoColumnar, PasoReferencia>;
+
+/**
+ * Implementación de filaMasLongeva.
+ *
+ * POR QUÉ: La persona más longeva es la de menor año de nacimiento.
+ * CÓMO: Recorriendo solo la columna anioNacimiento (2 bytes por fila), como un único grupo.
+ * PARA QUÉ: Mismo resultado que la versión con objetos (primera en caso de empate).
+ */
+size_t filaMasLongeva(const PersonaStore& store) {
+    return AnalisisColumnar::masLongeva(store);
+}
+
+std::array<size_t, NUM_CIUDADES> filasLongevasPorCiudad(const PersonaStore& store) {
+    return AnalisisColumnar::longevasPorCiudad(store);
+}
+
+size_t filaMayorPatrimonio(const PersonaStore& store) {
+    // Máximo vectorial de cada bloque; en empate gana el bloque anterior
+    const double* patrimonio = store.patrimonio.data();
+    return reducirPorBloques(store.size(), SIN_FILA,
+        [patrimonio](size_t& mejor, size_t inicio, size_t fin) {
+            mejor = inicio + posicionMaximo(patrimonio + inicio, fin - inicio);
+        },
+        [patrimonio](size_t& total, const size_t& parcial) {
+            if (total == SIN_FILA || patrimonio[parcial] > patrimonio[total]) total = parcial;
+        });
+}
+
+std::array<size_t, NUM_CIUDADES> filasMayorPatrimonioPorCiudad(const PersonaStore& store) {
+    return AnalisisColumnar::mayorPatrimonioPorCiudad(store);
+}
+
+std::array<size_t, 3> filasMayorPatrimonioPorGrupo(const PersonaStore& store) {
+    return AnalisisColumnar::mayorPatrimonioPorGrupo(store);
+}
+
+ConteoDeclarantes contarDeclarantesPorGrupo(const PersonaStore& store) {
+    const char* grupos = store.grupoDIAN.data();
+    const uint8_t* declara = store.declaranteRenta.data();
+
+    return reducirPorBloques(store.size(), ConteoDeclarantes(),
+        [&](ConteoDeclarantes& conteo, size_t inicio, size_t fin) {
+            contarMarcadosPorGrupo(grupos + inicio, 'A', 3, declara + inicio, fin - inicio,
+                                   conteo.total.data(), conteo.declarantes.data());
+        },
+        [](ConteoDeclarantes& total, const ConteoDeclarantes& parcial) { total.sumar(parcial); });
+}
+
+std::vector<PromedioCiudad> promediosOrdenados(const PatrimonioPorCiudad& acumulado) {
+    std::vector<PromedioCiudad> resultado;
+    for (size_t c = 0; c < NUM_CIUDADES; ++c) {
+        if (acumulado.conteo[c] == 0) continue;
+        resultado.push_back({static_cast<CiudadId>(c), acumulado.suma[c] / acumulado.conteo[c],
+                             acumulado.conteo[c]});
+    }
+
+    std::sort(resultado.begin(), resultado.end(),
+        [](const PromedioCiudad& a, const PromedioCiudad& b) { return a.promedio > b.promedio; });
+    return resultado;
+}
+
+/**
+ * Implementación de ciudadesPorPatrimonioPromedio.
+ *
+ * POR QUÉ: Evitar el std::map<std::string, ...> por fila de la versión con objetos.
+ * CÓMO: Acumulando suma y conteo en arreglos indexados por CiudadId, por bloques en paralelo.
+ * PARA QUÉ: Agrupación por indexación directa, sin comparar cadenas.
+ */
+std::vector<PromedioCiudad> ciudadesPorPatrimonioPromedio(const PersonaStore& store) {
+    PatrimonioPorCiudad acumulado;
+    acumularPatrimonioPorCiudad(store, acumulado);
+    return promediosOrdenados(acumulado);
+}
+
+void acumularPatrimonioPorCiudad(const PersonaStore& store, PatrimonioPorCiudad& acumulado) {
+    const double* patrimonio = store.patrimonio.data();
+    const CiudadId* ciudades = store.ciudad.data();
+    reducirPorBloquesSobre(acumulado, store.size(), PatrimonioPorCiudad(),
+        [&](PatrimonioPorCiudad& parcial, size_t inicio, size_t fin) {
+            // Mismo orden de suma que el bucle escalar (resultado idéntico)
+            acumularPorGrupo(ciudades + inicio, patrimonio + inicio, fin - inicio,
+                             parcial.suma.data(), parcial.conteo.data());
+        },
+        [](PatrimonioPorCiudad& total, const PatrimonioPorCiudad& parcial) { total.sumar(parcial); });
+}
+
+ConteoMayores60 contarMayores60PorGrupo(const PersonaStore& store) {
+    const char* grupos = store.grupoDIAN.data();
+    const uint16_t* anios = store.anioNacimiento.data();
+    const uint16_t anioLimite = static_cast<uint16_t>(ANIO_ACTUAL - 60); // edad > 60  <=>  año < anioLimite
+
+    return reducirPorBloques(store.size(), ConteoMayores60(),
+        [&](ConteoMayores60& conteo, size_t inicio, size_t fin) {
+            contarMenoresPorGrupo(grupos + inicio, 'A', 3, anios + inicio, anioLimite, fin - inicio,
+                                  conteo.total.data(), conteo.mayores60.data());
+        },
+        [](ConteoMayores60& total, const ConteoMayores60& parcial) { total.sumar(parcial); });
+}
+
+void acumularAnalisisCompleto(const PersonaStore& store, AnalisisCompleto& acumulado, size_t primeraFila) {
+    AnalisisColumnar::acumularCompleto(store, acumulado, primeraFila);
+}
+
+AnalisisCompleto analisisCompleto(const PersonaStore& store) {
+    AnalisisCompleto resultado;
+    acumularAnalisisCompleto(store, resultado);
+    return resultado;
+}
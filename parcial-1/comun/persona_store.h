@@ -0,0 +1,297 @@
+#ifndef PERSONA_STORE_H
+#define PERSONA_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ciudades.h"
+#include "fecha.h"
+
+/**
+ * Columna de valores: propia (std::vector) o vista de solo lectura sobre memoria externa.
+ *
+ * POR QUÉ: Un snapshot cargado con mmap ya tiene las columnas en el formato de memoria;
+ *          copiarlas a vectores anularía la carga inmediata.
+ * CÓMO: data(), size() y operator[] leen siempre de 'datos', que apunta al vector propio
+ *       o a la memoria mapeada. Solo las columnas propias admiten reserve, push_back,
+ *       asignar y pop_back (hacerPropia copia una vista para poder modificarla).
+ * PARA QUÉ: Que los análisis columnares recorran igual datos generados o mapeados.
+ */
+template <typename T>
+class Columna {
+public:
+    Columna() = default;
+    Columna(const Columna& otra) { *this = otra; }
+    Columna(Columna&& otra) noexcept { *this = std::move(otra); }
+
+    Columna& operator=(const Columna& otra) {
+        if (this == &otra) return *this;
+        propio = otra.propio;
+        cantidad = otra.cantidad;
+        datos = otra.esVista() ? otra.datos : propio.data();
+        return *this;
+    }
+
+    Columna& operator=(Columna&& otra) noexcept {
+        bool vista = otra.esVista();
+        propio = std::move(otra.propio);  // El buffer del vector cambia de dueño sin moverse
+        cantidad = otra.cantidad;
+        datos = vista ? otra.datos : propio.data();
+        otra.datos = nullptr;
+        otra.cantidad = 0;
+        return *this;
+    }
+
+    // Convierte la columna en una vista de 'n' valores en 'externos' (no se copian ni liberan)
+    void asignarVista(const T* externos, size_t n) {
+        std::vector<T>().swap(propio);
+        datos = externos;
+        cantidad = n;
+    }
+
+    bool esVista() const { return datos != nullptr && datos != propio.data(); }
+
+    // Copia los valores de una vista a la columna propia (no hace nada si ya es propia)
+    void hacerPropia() {
+        if (!esVista()) return;
+        propio.assign(datos, datos + cantidad);
+        datos = propio.data();
+    }
+
+    void reserve(size_t n) {
+        propio.reserve(n);
+        datos = propio.data();
+    }
+
+    void push_back(const T& valor) {
+        propio.push_back(valor);
+        datos = propio.data();
+        cantidad = propio.size();
+    }
+
+    void asignar(size_t i, const T& valor) { propio[i] = valor; }
+
+    void pop_back() {
+        propio.pop_back();
+        cantidad = propio.size();
+    }
+
+    const T& operator[](size_t i) const { return datos[i]; }
+    const T* data() const { return datos; }
+    const T* begin() const { return datos; }
+    const T* end() const { return datos + cantidad; }
+    size_t size() const { return cantidad; }
+    bool empty() const { return cantidad == 0; }
+
+private:
+    std::vector<T> propio;      // Valores propios (vacío en modo vista)
+    const T* datos = nullptr;   // propio.data() o la memoria externa
+    size_t cantidad = 0;
+};
+
+/**
+ * Almacén columnar (estructura de arreglos) de la población.
+ *
+ * POR QUÉ: Un std::vector<Persona> arrastra cerca de 200 bytes por registro a la caché
+ *          (nombres, IDs, fechas) aunque el análisis solo necesite un double.
+ * CÓMO: Un arreglo contiguo por atributo; la fila i corresponde a personas[i].
+ *       Las columnas son propias o, tras cargar un snapshot, vistas sobre el archivo mapeado.
+ * PARA QUÉ: Que cada análisis recorra únicamente las columnas que usa.
+ */
+struct PersonaStore {
+    Columna<double> patrimonio;        // Patrimonio total
+    Columna<double> ingresosAnuales;   // Ingresos anuales
+    Columna<double> deudas;            // Deudas totales
+    Columna<uint8_t> declaranteRenta;  // 1 si declara renta, 0 si no
+    Columna<CiudadId> ciudad;          // Ciudad de nacimiento (diccionario compartido)
+    Columna<uint16_t> anioNacimiento;  // Año de nacimiento
+    Columna<char> grupoDIAN;           // 'A', 'B' o 'C'
+    Columna<uint64_t> id;              // Número de documento (para el índice de IDs)
+
+    // Mantiene viva la memoria de las columnas en modo vista (p. ej. un snapshot mapeado)
+    std::shared_ptr<const void> respaldo;
+
+    size_t size() const { return patrimonio.size(); }
+    bool empty() const { return patrimonio.empty(); }
+
+    /**
+     * Reserva espacio en todas las columnas.
+     *
+     * POR QUÉ: Evitar realocaciones al construir el almacén fila por fila.
+     */
+    void reserve(size_t n);
+
+    /**
+     * Agrega una fila al final de todas las columnas.
+     */
+    void agregar(uint64_t idPersona, double ingresos, double patri, double deud, bool declara,
+                 CiudadId ciudadId, uint16_t anio, char grupo);
+
+    // --- Modificación en el lugar (solo con columnas propias) ---
+
+    /**
+     * Copia a memoria propia las columnas que son vistas y suelta el respaldo.
+     *
+     * POR QUÉ: Las vistas sobre un snapshot mapeado son de solo lectura.
+     */
+    void hacerPropio();
+
+    // Reemplaza los valores de una fila existente
+    void asignarFila(size_t fila, uint64_t idPersona, double ingresos, double patri, double deud, bool declara,
+                     CiudadId ciudadId, uint16_t anio, char grupo);
+
+    /**
+     * Quita una fila moviendo la última a su lugar.
+     *
+     * CÓMO: Copia la última fila sobre 'fila' y acorta las columnas: O(1), pero la fila
+     *       que era la última pasa a ser 'fila' (quien guarde filas debe actualizarlas).
+     */
+    void quitarFila(size_t fila);
+};
+
+// Índice que representa "sin resultado" en los análisis columnares
+const size_t SIN_FILA = static_cast<size_t>(-1);
+
+// Posición de un grupo DIAN ('A', 'B', 'C') en arreglos de tamaño 3
+inline int indiceGrupo(char grupo) { return grupo - 'A'; }
+
+// --- Análisis sobre columnas (devuelven filas; la impresión queda en cada variante) ---
+// Todos se ejecutan en paralelo con reducirPorBloques (paralelo.h), y los recorridos
+// numéricos de cada bloque con los núcleos SSE2/AVX2 de vectorial.h; el resultado,
+// incluidos los desempates, es el mismo que el de un recorrido secuencial.
+
+// Fila de la persona más longeva (menor año de nacimiento), o SIN_FILA si está vacío
+size_t filaMasLongeva(const PersonaStore& store);
+
+// Fila más longeva por ciudad (SIN_FILA si la ciudad no tiene personas)
+std::array<size_t, NUM_CIUDADES> filasLongevasPorCiudad(const PersonaStore& store);
+
+// Fila con mayor patrimonio, o SIN_FILA si está vacío
+size_t filaMayorPatrimonio(const PersonaStore& store);
+
+// Fila con mayor patrimonio por ciudad
+std::array<size_t, NUM_CIUDADES> filasMayorPatrimonioPorCiudad(const PersonaStore& store);
+
+// Fila con mayor patrimonio por grupo DIAN (posiciones A, B, C)
+std::array<size_t, 3> filasMayorPatrimonioPorGrupo(const PersonaStore& store);
+
+/**
+ * Conteo de personas y declarantes por grupo DIAN.
+ */
+struct ConteoDeclarantes {
+    std::array<size_t, 3> total{};        // Personas por grupo
+    std::array<size_t, 3> declarantes{};  // Declarantes por grupo
+
+    // Combina el conteo parcial de otro bloque
+    void sumar(const ConteoDeclarantes& otro) {
+        for (int g = 0; g < 3; ++g) {
+            total[g] += otro.total[g];
+            declarantes[g] += otro.declarantes[g];
+        }
+    }
+};
+ConteoDeclarantes contarDeclarantesPorGrupo(const PersonaStore& store);
+
+/**
+ * Patrimonio promedio de una ciudad.
+ */
+struct PromedioCiudad {
+    CiudadId ciudad;    // Ciudad
+    double promedio;    // Patrimonio promedio
+    size_t poblacion;   // Número de personas
+};
+
+/**
+ * Suma de patrimonio y población por ciudad (acumulador de la reducción).
+ */
+struct PatrimonioPorCiudad {
+    std::array<double, NUM_CIUDADES> suma{};    // Patrimonio acumulado
+    std::array<size_t, NUM_CIUDADES> conteo{};  // Personas
+
+    // Combina la suma parcial de otro bloque
+    void sumar(const PatrimonioPorCiudad& otro) {
+        for (size_t c = 0; c < NUM_CIUDADES; ++c) {
+            suma[c] += otro.suma[c];
+            conteo[c] += otro.conteo[c];
+        }
+    }
+};
+
+// Promedios de las ciudades con población, ordenados de mayor a menor
+std::vector<PromedioCiudad> promediosOrdenados(const PatrimonioPorCiudad& acumulado);
+
+// Suma el patrimonio y la población de cada ciudad del almacén sobre 'acumulado'
+// (por bloques, en orden: se puede continuar lote a lote con el mismo resultado)
+void acumularPatrimonioPorCiudad(const PersonaStore& store, PatrimonioPorCiudad& acumulado);
+
+// Ciudades ordenadas por patrimonio promedio descendente
+std::vector<PromedioCiudad> ciudadesPorPatrimonioPromedio(const PersonaStore& store);
+
+/**
+ * Conteo de personas mayores de 60 años por grupo DIAN.
+ */
+struct ConteoMayores60 {
+    std::array<size_t, 3> total{};      // Personas por grupo
+    std::array<size_t, 3> mayores60{};  // Mayores de 60 por grupo
+
+    // Combina el conteo parcial de otro bloque
+    void sumar(const ConteoMayores60& otro) {
+        for (int g = 0; g < 3; ++g) {
+            total[g] += otro.total[g];
+            mayores60[g] += otro.mayores60[g];
+        }
+    }
+};
+ConteoMayores60 contarMayores60PorGrupo(const PersonaStore& store);
+
+// --- Todos los análisis en una sola pasada ---
+
+// Fila ganadora de un análisis "mejor por grupo" y su valor
+struct MejorFila {
+    size_t fila = SIN_FILA;  // Fila (global en el modo por lotes)
+    double valor = 0;        // Año de nacimiento o patrimonio
+};
+
+// Posiciones de los ganadores en AnalisisCompleto::ganadores
+const size_t GANADOR_LONGEVA = 0;
+inline size_t ganadorLongevaCiudad(CiudadId c) { return 1 + c; }
+const size_t GANADOR_PATRIMONIO = 1 + NUM_CIUDADES;
+inline size_t ganadorPatrimonioCiudad(CiudadId c) { return 2 + NUM_CIUDADES + c; }
+inline size_t ganadorPatrimonioGrupo(int g) { return 2 + 2 * NUM_CIUDADES + static_cast<size_t>(g); }
+const size_t NUM_GANADORES = 5 + 2 * NUM_CIUDADES;
+
+/**
+ * Resultados de los análisis de las opciones 4-8.
+ *
+ * POR QUÉ: Cada análisis por separado vuelve a recorrer las columnas; juntos son cinco
+ *          recorridos de memoria para datos que caben en uno.
+ * CÓMO: Los ganadores (más longeva y mayor patrimonio: país, ciudad y grupo) como fila y
+ *       valor, y los acumuladores de declarantes, patrimonio por ciudad y mayores de 60.
+ */
+struct AnalisisCompleto {
+    std::array<MejorFila, NUM_GANADORES> ganadores{};
+    ConteoDeclarantes declarantes;
+    PatrimonioPorCiudad patrimonio;
+    ConteoMayores60 mayores60;
+};
+
+/**
+ * Calcula todos los análisis en una sola pasada sobre el almacén y los combina sobre 'acumulado'.
+ *
+ * POR QUÉ: Las opciones 4-8 juntas recorren las columnas cinco veces o más.
+ * CÓMO: reducirPorBloquesSobre con un AnalisisCompleto por bloque: cada fila actualiza
+ *       ganadores y acumuladores a la vez. Los bloques se combinan en orden (ganador
+ *       estrictamente mejor, sumas en el mismo orden), así que el resultado es idéntico
+ *       al de los análisis separados, también al continuar lote a lote.
+ * PARA QUÉ: El reporte completo en el tiempo de un recorrido de memoria.
+ *
+ * @param primeraFila Fila global de la fila 0 del almacén (0 salvo en el modo por lotes).
+ */
+void acumularAnalisisCompleto(const PersonaStore& store, AnalisisCompleto& acumulado, size_t primeraFila = 0);
+
+// Todos los análisis del almacén en una pasada (ver acumularAnalisisCompleto)
+AnalisisCompleto analisisCompleto(const PersonaStore& store);
+
+#endif // PERSONA_STORE_H
@@ -0,0 +1,85 @@
+#include "seleccion.h"
+#include <cmath>  // std::ceil, std::log, std::pow
+
+constexpr double BocetoCuantiles::ERROR_RELATIVO;
+
+// gamma = (1 + e) / (1 - e): razón entre los extremos de una cubeta
+static const double GAMMA = (1 + BocetoCuantiles::ERROR_RELATIVO) / (1 - BocetoCuantiles::ERROR_RELATIVO);
+static const double LOG_GAMMA = std::log(GAMMA);
+
+size_t posicionPercentil(double p, size_t cantidad) {
+    size_t rango = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(cantidad)));
+    if (rango == 0) rango = 1;
+    if (rango > cantidad) rango = cantidad;
+    return rango - 1;
+}
+
+int BocetoCuantiles::cubetaDe(double valor) {
+    return static_cast<int>(std::ceil(std::log(valor) / LOG_GAMMA));
+}
+
+void BocetoCuantiles::agregar(double valor) {
+    if (total == 0 || valor < minimo) minimo = valor;
+    if (total == 0 || valor > maximo) maximo = valor;
+    ++total;
+    if (valor <= 0) {
+        ++noPositivos;
+        return;
+    }
+
+    int cubeta = cubetaDe(valor);
+    if (cubetas.empty()) {
+        primera = cubeta;
+        cubetas.assign(1, 0);
+    } else if (cubeta < primera) {
+        cubetas.insert(cubetas.begin(), static_cast<size_t>(primera - cubeta), 0);
+        primera = cubeta;
+    } else if (static_cast<size_t>(cubeta - primera) >= cubetas.size()) {
+        cubetas.resize(static_cast<size_t>(cubeta - primera) + 1, 0);
+    }
+    cubetas[static_cast<size_t>(cubeta - primera)]++;
+}
+
+void BocetoCuantiles::sumar(const BocetoCuantiles& otro) {
+    if (otro.total == 0) return;
+    if (total == 0 || otro.minimo < minimo) minimo = otro.minimo;
+    if (total == 0 || otro.maximo > maximo) maximo = otro.maximo;
+    total += otro.total;
+    noPositivos += otro.noPositivos;
+    if (otro.cubetas.empty()) return;
+
+    if (cubetas.empty()) {
+        cubetas = otro.cubetas;
+        primera = otro.primera;
+        return;
+    }
+    if (otro.primera < primera) {
+        cubetas.insert(cubetas.begin(), static_cast<size_t>(primera - otro.primera), 0);
+        primera = otro.primera;
+    }
+    size_t desde = static_cast<size_t>(otro.primera - primera);
+    if (desde + otro.cubetas.size() > cubetas.size()) cubetas.resize(desde + otro.cubetas.size(), 0);
+    for (size_t i = 0; i < otro.cubetas.size(); ++i) cubetas[desde + i] += otro.cubetas[i];
+}
+
+/**
+ * Implementación de percentil.
+ *
+ * CÓMO: Recorre las cubetas acumulando conteos hasta la que contiene la posición pedida
+ *       y devuelve 2 * gamma^i / (gamma + 1), acotado al mínimo y máximo vistos.
+ */
+bool BocetoCuantiles::percentil(double p, double& valor) const {
+    if (total == 0) return false;
+    uint64_t buscada = posicionPercentil(p, static_cast<size_t>(total));
+    if (buscada < noPositivos) {
+        valor = minimo;
+        return true;
+    }
+
+    uint64_t acumulado = noPositivos;
+    size_t i = 0;
+    while (i + 1 < cubetas.size() && acumulado + cubetas[i] <= buscada) acumulado += cubetas[i++];
+    valor = 2 * std::pow(GAMMA, primera + static_cast<int>(i)) / (GAMMA + 1);
+    valor = std::min(std::max(valor, minimo), maximo);
+    return true;
+}
@@ -0,0 +1,234 @@
+#ifndef SELECCION_H
+#define SELECCION_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "paralelo.h"
+
+// --- Motor de selección: top-K y cuantiles sin ordenar el conjunto ---
+
+/**
+ * Fila candidata de una selección top-K y su valor.
+ */
+struct Candidato {
+    double valor;
+    size_t fila;
+};
+
+// 'a' va antes que 'b' en un top-K: mayor valor y, en empate, la fila anterior
+inline bool candidatoAntes(const Candidato& a, const Candidato& b) {
+    return a.valor > b.valor || (a.valor == b.valor && a.fila < b.fila);
+}
+
+/**
+ * Las K filas de mayor valor vistas hasta ahora.
+ *
+ * POR QUÉ: Los 100 más ricos de cada ciudad con un ordenamiento completo cuestan
+ *          O(n log n) y una copia de todas las filas.
+ * CÓMO: Montículo acotado a K elementos con el peor candidato en la raíz: cada fila
+ *       nueva solo se compara con esa raíz y reemplaza al peor si lo supera. El orden
+ *       (valor, fila) es total, así que el resultado no depende del orden de llegada.
+ * PARA QUÉ: Top-K en una pasada, O(n log K), combinable entre bloques (sumar).
+ */
+class MayoresK {
+public:
+    explicit MayoresK(size_t k = 0) : k(k) {}
+
+    // Considera la fila; O(1) si no entra al top-K
+    void proponer(double valor, size_t fila) {
+        Candidato candidato{valor, fila};
+        if (monticulo.size() < k) {
+            monticulo.push_back(candidato);
+            std::push_heap(monticulo.begin(), monticulo.end(), candidatoAntes);
+        } else if (k > 0 && candidatoAntes(candidato, monticulo.front())) {
+            std::pop_heap(monticulo.begin(), monticulo.end(), candidatoAntes);
+            monticulo.back() = candidato;
+            std::push_heap(monticulo.begin(), monticulo.end(), candidatoAntes);
+        }
+    }
+
+    // Combina los candidatos de otro bloque
+    void sumar(const MayoresK& otro) {
+        for (const Candidato& c : otro.monticulo) proponer(c.valor, c.fila);
+    }
+
+    // Candidatos de mayor a menor valor (a lo sumo K)
+    std::vector<Candidato> ordenados() const {
+        std::vector<Candidato> resultado(monticulo);
+        std::sort(resultado.begin(), resultado.end(), candidatoAntes);
+        return resultado;
+    }
+
+    size_t size() const { return monticulo.size(); }
+
+private:
+    size_t k;
+    std::vector<Candidato> monticulo;  // Montículo con el peor candidato en front()
+};
+
+/**
+ * Las K filas de mayor valor de cada grupo (ciudad, grupo DIAN), en una pasada paralela.
+ *
+ * CÓMO: reducirPorBloques con un MayoresK por grupo y por bloque; los bloques se combinan
+ *       proponiendo sus candidatos al total.
+ *
+ * @param grupoDe Se invoca como grupoDe(fila) y devuelve la posición del grupo (< N).
+ * @param valorDe Se invoca como valorDe(fila).
+ * @return Por grupo, los candidatos de mayor a menor valor (en empate, la fila anterior).
+ */
+template <size_t N, typename GrupoDe, typename ValorDe>
+std::array<std::vector<Candidato>, N> mayoresPorGrupo(size_t total, size_t k, GrupoDe grupoDe, ValorDe valorDe,
+                                                      unsigned hilos = 0) {
+    std::array<MayoresK, N> inicial;
+    inicial.fill(MayoresK(k));
+    std::array<MayoresK, N> mayores = reducirPorBloques(total, inicial,
+        [&](std::array<MayoresK, N>& parcial, size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; ++i) parcial[grupoDe(i)].proponer(valorDe(i), i);
+        },
+        [](std::array<MayoresK, N>& acumulado, const std::array<MayoresK, N>& parcial) {
+            for (size_t g = 0; g < N; ++g) acumulado[g].sumar(parcial[g]);
+        }, hilos);
+
+    std::array<std::vector<Candidato>, N> resultado;
+    for (size_t g = 0; g < N; ++g) resultado[g] = mayores[g].ordenados();
+    return resultado;
+}
+
+// Posición (desde 0) del percentil 'p' (0-100) entre 'cantidad' valores ordenados,
+// por rango más cercano: ceil(p/100 * cantidad) - 1, al menos 0
+size_t posicionPercentil(double p, size_t cantidad);
+
+/**
+ * Percentiles exactos de cada grupo sin ordenar los valores.
+ *
+ * POR QUÉ: Deciles de patrimonio o la mediana de ingresos por grupo DIAN se calculaban
+ *          ordenando todo el conjunto.
+ * CÓMO: Tres pasos paralelos: conteo por grupo y bloque; copia de cada valor a la zona
+ *       de su grupo (cada bloque escribe en su tramo, sin cerrojos); y, por grupo,
+ *       std::nth_element para cada percentil de menor a mayor, empezando cada uno donde
+ *       quedó el anterior.
+ * PARA QUÉ: Respuesta exacta en O(n) con una copia de los valores.
+ *
+ * @param percentiles Percentiles pedidos (0-100), en cualquier orden.
+ * @return Por grupo, el valor de cada percentil en el orden pedido (vacío si el grupo no tiene filas).
+ */
+template <size_t N, typename GrupoDe, typename ValorDe>
+std::array<std::vector<double>, N> percentilesPorGrupo(size_t total, GrupoDe grupoDe, ValorDe valorDe,
+                                                       const std::vector<double>& percentiles,
+                                                       unsigned hilos = 0) {
+    using Conteo = std::array<size_t, N>;
+    size_t numBloques = (total + BLOQUE_REDUCCION - 1) / BLOQUE_REDUCCION;
+
+    // Filas de cada grupo por bloque
+    std::vector<Conteo> posiciones(numBloques, Conteo{});
+    paraCadaBloque(total, BLOQUE_REDUCCION, hilos, [&](size_t bloque, size_t inicio, size_t fin) {
+        Conteo conteo{};
+        for (size_t i = inicio; i < fin; ++i) conteo[grupoDe(i)]++;
+        posiciones[bloque] = conteo;
+    });
+
+    // Zona de cada grupo y, dentro de ella, primera posición de cada bloque
+    std::array<size_t, N + 1> zona{};
+    for (size_t b = 0; b < numBloques; ++b) {
+        for (size_t g = 0; g < N; ++g) zona[g + 1] += posiciones[b][g];
+    }
+    for (size_t g = 0; g < N; ++g) zona[g + 1] += zona[g];
+    Conteo siguiente;
+    for (size_t g = 0; g < N; ++g) siguiente[g] = zona[g];
+    for (size_t b = 0; b < numBloques; ++b) {
+        for (size_t g = 0; g < N; ++g) {
+            size_t filas = posiciones[b][g];
+            posiciones[b][g] = siguiente[g];
+            siguiente[g] += filas;
+        }
+    }
+
+    std::vector<double> valores(total);
+    paraCadaBloque(total, BLOQUE_REDUCCION, hilos, [&](size_t bloque, size_t inicio, size_t fin) {
+        Conteo destino = posiciones[bloque];
+        for (size_t i = inicio; i < fin; ++i) valores[destino[grupoDe(i)]++] = valorDe(i);
+    });
+
+    // Percentiles de menor a mayor: cada nth_element solo mira lo que está a la derecha del anterior
+    std::vector<size_t> orden(percentiles.size());
+    for (size_t j = 0; j < orden.size(); ++j) orden[j] = j;
+    std::sort(orden.begin(), orden.end(), [&](size_t a, size_t b) { return percentiles[a] < percentiles[b]; });
+
+    std::array<std::vector<double>, N> resultado;
+    paraCadaBloque(N, 1, hilos, [&](size_t g, size_t, size_t) {
+        size_t cantidad = zona[g + 1] - zona[g];
+        if (cantidad == 0) return;
+        auto inicio = valores.begin() + static_cast<std::ptrdiff_t>(zona[g]);
+        auto fin = inicio + static_cast<std::ptrdiff_t>(cantidad);
+        auto desde = inicio;
+        resultado[g].resize(percentiles.size());
+        for (size_t j : orden) {
+            auto nesimo = inicio + static_cast<std::ptrdiff_t>(posicionPercentil(percentiles[j], cantidad));
+            std::nth_element(desde, nesimo, fin);
+            resultado[g][j] = *nesimo;
+            desde = nesimo;
+        }
+    });
+    return resultado;
+}
+
+/**
+ * Boceto de cuantiles aproximados con error relativo acotado.
+ *
+ * POR QUÉ: Los percentiles exactos necesitan copiar los valores; un boceto de pocos KB
+ *          responde cualquier percentil después de una sola pasada sin copiarlos.
+ * CÓMO: Cubetas logarítmicas (como DDSketch): el valor v > 0 cae en la cubeta
+ *       ceil(log_gamma(v)), con gamma = (1 + e) / (1 - e); el punto medio de una cubeta
+ *       está a menos de e (ERROR_RELATIVO) de cualquier valor que contiene. Los valores
+ *       <= 0 se cuentan aparte y se informan como el mínimo visto. Dos bocetos se
+ *       combinan sumando sus cubetas, así que el resultado no depende de los bloques.
+ * PARA QUÉ: Percentiles aproximados en una pasada paralela con memoria independiente
+ *           del número de personas.
+ */
+class BocetoCuantiles {
+public:
+    static constexpr double ERROR_RELATIVO = 0.01;
+
+    void agregar(double valor);
+
+    // Combina el boceto de otro bloque
+    void sumar(const BocetoCuantiles& otro);
+
+    size_t cantidad() const { return static_cast<size_t>(total); }
+
+    // Percentil 'p' (0-100) por rango más cercano, con error relativo <= ERROR_RELATIVO;
+    // false si el boceto está vacío
+    bool percentil(double p, double& valor) const;
+
+    // Memoria de las cubetas en bytes
+    size_t memoriaBytes() const { return cubetas.capacity() * sizeof(uint64_t); }
+
+private:
+    static int cubetaDe(double valor);
+
+    std::vector<uint64_t> cubetas;  // cubetas[i]: valores en la cubeta primera + i
+    int primera = 0;
+    uint64_t noPositivos = 0;       // Valores <= 0
+    uint64_t total = 0;
+    double minimo = 0;
+    double maximo = 0;
+};
+
+/**
+ * Un boceto de cuantiles por grupo, en una pasada paralela (reducirPorBloques).
+ */
+template <size_t N, typename GrupoDe, typename ValorDe>
+std::array<BocetoCuantiles, N> bocetosPorGrupo(size_t total, GrupoDe grupoDe, ValorDe valorDe, unsigned hilos = 0) {
+    return reducirPorBloques(total, std::array<BocetoCuantiles, N>{},
+        [&](std::array<BocetoCuantiles, N>& parcial, size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; ++i) parcial[grupoDe(i)].agregar(valorDe(i));
+        },
+        [](std::array<BocetoCuantiles, N>& acumulado, const std::array<BocetoCuantiles, N>& parcial) {
+            for (size_t g = 0; g < N; ++g) acumulado[g].sumar(parcial[g]);
+        }, hilos);
+}
+
+#endif // SELECCION_H
@@ -0,0 +1,360 @@
+#include "snapshot.h"
+#include "paralelo.h" // paraCadaBloque, reducirPorBloques
+#include "archivo_mapeado.h"
+#include "fecha.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>  // std::rename
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+static const char MAGIA_SNAPSHOT[8] = {'P', 'E', 'R', 'S', 'N', 'A', 'P', '\0'};
+
+// Bytes por bloque de la suma de verificación (coincide con el buffer de escritura)
+static const size_t BLOQUE_SUMA = 1 << 20;
+
+// Alineación de cada sección (línea de caché; también sirve a cualquier tipo de columna)
+static const uint64_t ALINEACION_SECCION = 64;
+
+static inline uint64_t rotar(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+static inline uint64_t mezclarFinal(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * Suma de verificación de un bloque.
+ *
+ * POR QUÉ: Detectar archivos truncados o dañados sin depender de una biblioteca externa.
+ * CÓMO: Cuatro acumuladores independientes (multiplicación y rotación por palabra de 8 bytes)
+ *       para que la CPU los procese en paralelo; al final se mezclan con la longitud.
+ */
+static uint64_t sumaBloque(const char* datos, size_t n) {
+    const uint64_t K1 = 0x9E3779B97F4A7C15ULL;
+    const uint64_t K2 = 0xC2B2AE3D27D4EB4FULL;
+    uint64_t h[4] = {K1, K2, K1 ^ K2, K1 + K2};
+
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        for (int k = 0; k < 4; ++k) {
+            uint64_t w;
+            std::memcpy(&w, datos + i + 8 * k, 8);
+            h[k] = rotar(h[k] ^ (w * K2), 31) * K1;
+        }
+    }
+    uint64_t resto[4] = {0, 0, 0, 0};
+    std::memcpy(resto, datos + i, n - i);
+    for (int k = 0; k < 4; ++k) h[k] = rotar(h[k] ^ (resto[k] * K2), 31) * K1;
+
+    return mezclarFinal(h[0] ^ rotar(h[1], 17) ^ rotar(h[2], 34) ^ rotar(h[3], 51) ^ n);
+}
+
+// Acumula la suma de un bloque en la suma total (depende del orden de los bloques)
+static inline uint64_t combinarSuma(uint64_t total, uint64_t bloque) {
+    return mezclarFinal(total ^ bloque) + 0x9E3779B97F4A7C15ULL;
+}
+
+static uint64_t sumaCabecera(CabeceraSnapshot cabecera) {
+    cabecera.sumaCabecera = 0;
+    return sumaBloque(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+}
+
+static inline uint64_t alinear(uint64_t x) {
+    return (x + ALINEACION_SECCION - 1) / ALINEACION_SECCION * ALINEACION_SECCION;
+}
+
+// Bytes de cada sección para 'filas' personas y el diccionario indicado
+static uint64_t bytesSeccion(int s, uint64_t filas, uint64_t numCadenas, uint64_t bytesTexto) {
+    switch (s) {
+        case SEC_ID: return filas * sizeof(uint64_t);
+        case SEC_INGRESOS: case SEC_PATRIMONIO: case SEC_DEUDAS: return filas * sizeof(double);
+        case SEC_FECHA: case SEC_NOMBRE: case SEC_APELLIDO: return filas * sizeof(uint32_t);
+        case SEC_ANIO: return filas * sizeof(uint16_t);
+        case SEC_CIUDAD: return filas * sizeof(CiudadId);
+        case SEC_DECLARANTE: return filas * sizeof(uint8_t);
+        case SEC_GRUPO: return filas * sizeof(char);
+        case SEC_DICC_INICIOS: return (numCadenas + 1) * sizeof(uint64_t);
+        case SEC_DICC_TEXTO: return bytesTexto;
+    }
+    return 0;
+}
+
+std::vector<std::string> inicioDiccionario() {
+    return std::vector<std::string>(ciudadesColombia.begin(), ciudadesColombia.end());
+}
+
+/**
+ * Escritor secuencial por bloques de BLOQUE_SUMA bytes.
+ *
+ * POR QUÉ: El archivo puede ocupar cientos de MB; no se arma en memoria.
+ * CÓMO: Cada bloque lleno se suma y se entrega a write(2); así los bloques de la suma
+ *       coinciden con los que verifica Snapshot::abrir.
+ */
+class EscritorBloques {
+public:
+    explicit EscritorBloques(int descriptor) : descriptor(descriptor), buffer(BLOQUE_SUMA) {}
+
+    void agregar(const void* datos, size_t n) {
+        const char* origen = static_cast<const char*>(datos);
+        while (n > 0) {
+            size_t parte = std::min(n, buffer.size() - usados);
+            std::memcpy(buffer.data() + usados, origen, parte);
+            usados += parte;
+            origen += parte;
+            n -= parte;
+            if (usados == buffer.size()) vaciar();
+        }
+    }
+
+    // Rellena con ceros hasta la siguiente sección alineada
+    void alinearSeccion() {
+        static const char ceros[ALINEACION_SECCION] = {};
+        uint64_t posicion = sizeof(CabeceraSnapshot) + escritos + usados;
+        agregar(ceros, alinear(posicion) - posicion);
+    }
+
+    // Vacía el último bloque (parcial); devuelve false si alguna escritura falló
+    bool terminar() {
+        if (usados > 0) vaciar();
+        return !error;
+    }
+
+    uint64_t suma() const { return total; }
+
+private:
+    void vaciar() {
+        total = combinarSuma(total, sumaBloque(buffer.data(), usados));
+        const char* datos = buffer.data();
+        size_t pendiente = usados;
+        while (pendiente > 0 && !error) {
+            ssize_t n = write(descriptor, datos, pendiente);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) { error = true; break; }
+            datos += n;
+            pendiente -= static_cast<size_t>(n);
+        }
+        escritos += usados;
+        usados = 0;
+    }
+
+    int descriptor;
+    std::vector<char> buffer;
+    size_t usados = 0;
+    uint64_t escritos = 0;
+    uint64_t total = 0;
+    bool error = false;
+};
+
+bool guardarSnapshot(const std::string& ruta, const ColumnasSnapshot& columnas, std::string& error) {
+    // Diccionario: inicio de cada cadena dentro del texto
+    std::vector<uint64_t> inicios(columnas.cadenas.size() + 1, 0);
+    for (size_t i = 0; i < columnas.cadenas.size(); ++i) {
+        inicios[i + 1] = inicios[i] + columnas.cadenas[i].size();
+    }
+
+    CabeceraSnapshot cabecera;
+    std::memset(&cabecera, 0, sizeof(cabecera));
+    std::memcpy(cabecera.magia, MAGIA_SNAPSHOT, sizeof(MAGIA_SNAPSHOT));
+    cabecera.version = VERSION_SNAPSHOT;
+    cabecera.marcaOrden = MARCA_ORDEN_SNAPSHOT;
+    cabecera.tamCabecera = sizeof(CabeceraSnapshot);
+    cabecera.filas = columnas.filas;
+    cabecera.numCadenas = columnas.cadenas.size();
+    cabecera.bytesTexto = inicios.back();
+
+    uint64_t posicion = sizeof(CabeceraSnapshot);
+    for (int s = 0; s < NUM_SECCIONES; ++s) {
+        cabecera.desplazamiento[s] = posicion;
+        posicion = alinear(posicion + bytesSeccion(s, cabecera.filas, cabecera.numCadenas, cabecera.bytesTexto));
+    }
+    cabecera.tamArchivo = posicion;
+
+    // Se escribe en un temporal y se renombra: un snapshot a medio escribir nunca queda con el nombre final
+    std::string temporal = ruta + ".tmp";
+    int descriptor = open(temporal.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0) {
+        error = "no se pudo crear '" + temporal + "': " + std::strerror(errno);
+        return false;
+    }
+
+    bool correcto = lseek(descriptor, sizeof(CabeceraSnapshot), SEEK_SET) >= 0;
+    EscritorBloques escritor(descriptor);
+    const void* secciones[] = {
+        columnas.id, columnas.ingresos, columnas.patrimonio, columnas.deudas, columnas.fecha,
+        columnas.nombre, columnas.apellido, columnas.anio, columnas.ciudad, columnas.declarante,
+        columnas.grupo, inicios.data()
+    };
+    for (int s = 0; s < SEC_DICC_TEXTO; ++s) {
+        escritor.agregar(secciones[s], bytesSeccion(s, cabecera.filas, cabecera.numCadenas, cabecera.bytesTexto));
+        escritor.alinearSeccion();
+    }
+    for (const std::string& cadena : columnas.cadenas) escritor.agregar(cadena.data(), cadena.size());
+    escritor.alinearSeccion();
+    correcto = escritor.terminar() && correcto;
+
+    cabecera.sumaDatos = escritor.suma();
+    cabecera.sumaCabecera = sumaCabecera(cabecera);
+    correcto = correcto && pwrite(descriptor, &cabecera, sizeof(cabecera), 0) == static_cast<ssize_t>(sizeof(cabecera));
+    correcto = (close(descriptor) == 0) && correcto;
+
+    if (!correcto || std::rename(temporal.c_str(), ruta.c_str()) != 0) {
+        error = "error al escribir '" + ruta + "': " + std::strerror(errno);
+        unlink(temporal.c_str());
+        return false;
+    }
+    return true;
+}
+
+// --- Lectura ---
+
+// Verifica la suma de todos los bloques de datos en paralelo (un bloque por tarea)
+static uint64_t sumaDatos(const char* datos, size_t n) {
+    size_t numBloques = (n + BLOQUE_SUMA - 1) / BLOQUE_SUMA;
+    std::vector<uint64_t> sumas(numBloques);
+    paraCadaBloque(numBloques, 1, 0, [&](size_t, size_t inicio, size_t fin) {
+        for (size_t b = inicio; b < fin; ++b) {
+            size_t desde = b * BLOQUE_SUMA;
+            sumas[b] = sumaBloque(datos + desde, std::min(BLOQUE_SUMA, n - desde));
+        }
+    });
+
+    uint64_t total = 0;
+    for (uint64_t suma : sumas) total = combinarSuma(total, suma);
+    return total;
+}
+
+std::unique_ptr<Snapshot> Snapshot::abrir(const std::string& ruta, bool verificarDatos, std::string& error) {
+    std::shared_ptr<ArchivoMapeado> archivo = ArchivoMapeado::abrir(ruta, error);
+    if (!archivo) return nullptr;
+    if (archivo->tam() < sizeof(CabeceraSnapshot)) {
+        error = "'" + ruta + "' no es un snapshot (archivo demasiado corto)";
+        return nullptr;
+    }
+    size_t tam = archivo->tam();
+
+    std::unique_ptr<Snapshot> snapshot(new Snapshot());
+    snapshot->archivo = std::move(archivo);
+    snapshot->base = snapshot->archivo->datos();
+    snapshot->cabecera = reinterpret_cast<const CabeceraSnapshot*>(snapshot->base);
+    const CabeceraSnapshot& cabecera = *snapshot->cabecera;
+
+    // Cabecera
+    if (std::memcmp(cabecera.magia, MAGIA_SNAPSHOT, sizeof(MAGIA_SNAPSHOT)) != 0) {
+        error = "'" + ruta + "' no es un snapshot (firma desconocida)";
+        return nullptr;
+    }
+    if (cabecera.marcaOrden != MARCA_ORDEN_SNAPSHOT) {
+        error = "snapshot escrito con otro orden de bytes";
+        return nullptr;
+    }
+    if (cabecera.version != VERSION_SNAPSHOT || cabecera.tamCabecera != sizeof(CabeceraSnapshot)) {
+        error = "versión de snapshot no soportada (" + std::to_string(cabecera.version) + ")";
+        return nullptr;
+    }
+    if (cabecera.sumaCabecera != sumaCabecera(cabecera)) {
+        error = "cabecera dañada (suma de verificación)";
+        return nullptr;
+    }
+    if (cabecera.tamArchivo != tam) {
+        error = "tamaño inesperado: el archivo está truncado o tiene bytes de más";
+        return nullptr;
+    }
+
+    // Secciones: alineadas y dentro del archivo (filas < 2^32 para los índices de 32 bits)
+    if (cabecera.filas >= UINT32_MAX || cabecera.numCadenas < NUM_CIUDADES || cabecera.numCadenas >= UINT32_MAX) {
+        error = "conteos fuera de rango en la cabecera";
+        return nullptr;
+    }
+    for (int s = 0; s < NUM_SECCIONES; ++s) {
+        uint64_t inicio = cabecera.desplazamiento[s];
+        uint64_t bytes = bytesSeccion(s, cabecera.filas, cabecera.numCadenas, cabecera.bytesTexto);
+        if (inicio < sizeof(CabeceraSnapshot) || inicio % ALINEACION_SECCION != 0 ||
+            inicio > tam || bytes > tam - inicio) {
+            error = "sección " + std::to_string(s) + " fuera del archivo";
+            return nullptr;
+        }
+    }
+
+    if (verificarDatos &&
+        sumaDatos(snapshot->base + sizeof(CabeceraSnapshot), tam - sizeof(CabeceraSnapshot)) != cabecera.sumaDatos) {
+        error = "datos dañados (suma de verificación)";
+        return nullptr;
+    }
+
+    // Diccionario: inicios crecientes dentro del texto y ciudades en el orden de CiudadId
+    const uint64_t* inicios = snapshot->seccion<uint64_t>(SEC_DICC_INICIOS);
+    if (inicios[0] != 0 || inicios[cabecera.numCadenas] != cabecera.bytesTexto) {
+        error = "diccionario de cadenas inválido";
+        return nullptr;
+    }
+    for (uint64_t i = 0; i < cabecera.numCadenas; ++i) {
+        if (inicios[i] > inicios[i + 1]) {
+            error = "diccionario de cadenas inválido";
+            return nullptr;
+        }
+    }
+    for (size_t c = 0; c < NUM_CIUDADES; ++c) {
+        if (snapshot->cadena(static_cast<uint32_t>(c)) != ciudadesColombia[c]) {
+            error = "el snapshot usa otra tabla de ciudades";
+            return nullptr;
+        }
+    }
+
+    // Columnas que los análisis usan como índice de arreglos: deben estar en rango. El año
+    // se guarda aparte de la fecha (los análisis solo leen el año), así que debe coincidir con ella
+    const CiudadId* ciudades = snapshot->ciudad();
+    const char* grupos = snapshot->grupo();
+    const uint32_t* fechas = snapshot->fecha();
+    const uint16_t* anios = snapshot->anio();
+    size_t invalidas = reducirPorBloques(snapshot->filas(), size_t(0),
+        [&](size_t& cuenta, size_t inicio, size_t fin) {
+            for (size_t i = inicio; i < fin; ++i) {
+                cuenta += (ciudades[i] >= NUM_CIUDADES) + (grupos[i] < 'A' || grupos[i] > 'C') +
+                          (anios[i] != anioDeFecha(fechas[i]) || anios[i] > ANIO_ACTUAL ||
+                           anios[i] < ANIO_ACTUAL - EDAD_MAXIMA_ARCHIVO);
+            }
+        },
+        [](size_t& total, size_t parcial) { total += parcial; });
+    if (invalidas > 0) {
+        error = std::to_string(invalidas) + " valores de ciudad, grupo DIAN o año de nacimiento fuera de rango";
+        return nullptr;
+    }
+
+    return snapshot;
+}
+
+std::string Snapshot::cadena(uint32_t indice) const {
+    if (indice >= cabecera->numCadenas) return std::string();
+    const uint64_t* inicios = seccion<uint64_t>(SEC_DICC_INICIOS);
+    const char* texto = seccion<char>(SEC_DICC_TEXTO);
+    return std::string(texto + inicios[indice], static_cast<size_t>(inicios[indice + 1] - inicios[indice]));
+}
+
+PersonaStore Snapshot::vista() const {
+    size_t n = filas();
+    PersonaStore store;
+    store.id.asignarVista(id(), n);
+    store.ingresosAnuales.asignarVista(ingresos(), n);
+    store.patrimonio.asignarVista(patrimonio(), n);
+    store.deudas.asignarVista(deudas(), n);
+    store.anioNacimiento.asignarVista(anio(), n);
+    store.ciudad.asignarVista(ciudad(), n);
+    store.declaranteRenta.asignarVista(declarante(), n);
+    store.grupoDIAN.asignarVista(grupo(), n);
+    store.respaldo = archivo;
+    return store;
+}
+
+void Snapshot::liberarFilas(size_t desde, size_t hasta) const {
+    for (int s = SEC_ID; s <= SEC_GRUPO; ++s) {
+        uint64_t ancho = bytesSeccion(s, 1, 0, 0);
+        uint64_t inicio = cabecera->desplazamiento[s];
+        archivo->liberar(static_cast<size_t>(inicio + desde * ancho), static_cast<size_t>(inicio + hasta * ancho));
+    }
+}
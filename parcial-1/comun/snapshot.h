@@ -0,0 +1,156 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ciudades.h"
+#include "persona_store.h"
+
+/**
+ * Snapshot binario versionado de la población.
+ *
+ * POR QUÉ: Cada sesión regeneraba el conjunto con la opción 0; no había forma de
+ *          guardarlo ni de volver a abrirlo.
+ * CÓMO: Un archivo con cabecera fija, una sección por columna (ancho fijo, alineada a
+ *       64 bytes) y un diccionario de cadenas (ciudades, nombres y apellidos). Se abre con
+ *       mmap: las columnas del PersonaStore quedan como vistas sobre las páginas mapeadas.
+ * PARA QUÉ: Abrir millones de personas en milisegundos y analizarlas sin copiarlas.
+ *
+ * Formato (versión 1, orden de bytes del equipo, verificado con 'marcaOrden'):
+ *   [CabeceraSnapshot][columna 0]...[columna N][desplazamientos del diccionario][texto]
+ * Las primeras NUM_CIUDADES cadenas del diccionario son las ciudades en orden de CiudadId.
+ */
+
+const uint32_t VERSION_SNAPSHOT = 1;
+const uint32_t MARCA_ORDEN_SNAPSHOT = 0x01020304;
+
+// Secciones del archivo, en el orden en que se escriben
+enum SeccionSnapshot {
+    SEC_ID,            // uint64_t
+    SEC_INGRESOS,      // double
+    SEC_PATRIMONIO,    // double
+    SEC_DEUDAS,        // double
+    SEC_FECHA,         // uint32_t (AAAAMMDD)
+    SEC_NOMBRE,        // uint32_t (índice en el diccionario)
+    SEC_APELLIDO,      // uint32_t (índice en el diccionario)
+    SEC_ANIO,          // uint16_t
+    SEC_CIUDAD,        // CiudadId
+    SEC_DECLARANTE,    // uint8_t (0/1)
+    SEC_GRUPO,         // char ('A', 'B', 'C')
+    SEC_DICC_INICIOS,  // uint64_t[numCadenas + 1]: inicio de cada cadena en el texto
+    SEC_DICC_TEXTO,    // char[bytesTexto]
+    NUM_SECCIONES
+};
+
+// Cabecera del archivo (256 bytes; las secciones empiezan alineadas a 64)
+struct CabeceraSnapshot {
+    char magia[8];                          // "PERSNAP\0"
+    uint32_t version;                       // VERSION_SNAPSHOT
+    uint32_t marcaOrden;                    // MARCA_ORDEN_SNAPSHOT (detecta otro orden de bytes)
+    uint64_t tamCabecera;                   // sizeof(CabeceraSnapshot)
+    uint64_t tamArchivo;                    // Bytes totales del archivo
+    uint64_t filas;                         // Personas
+    uint64_t numCadenas;                    // Entradas del diccionario
+    uint64_t bytesTexto;                    // Bytes de texto del diccionario
+    uint64_t desplazamiento[NUM_SECCIONES]; // Inicio de cada sección
+    uint64_t sumaDatos;                     // Suma de verificación de todo lo que sigue a la cabecera
+    uint64_t sumaCabecera;                  // Suma de la cabecera con este campo en 0
+    uint8_t reservado[256 - 8 - 4 - 4 - 5 * 8 - NUM_SECCIONES * 8 - 2 * 8];
+};
+static_assert(sizeof(CabeceraSnapshot) == 256, "La cabecera del snapshot debe ocupar 256 bytes");
+
+/**
+ * Columnas de una población lista para guardar.
+ *
+ * POR QUÉ: Persona es distinta en cada variante; el formato solo necesita arreglos.
+ * CÓMO: Punteros a 'filas' valores por columna (propiedad del llamador) y el diccionario.
+ */
+struct ColumnasSnapshot {
+    size_t filas = 0;
+    const uint64_t* id = nullptr;
+    const double* ingresos = nullptr;
+    const double* patrimonio = nullptr;
+    const double* deudas = nullptr;
+    const uint32_t* fecha = nullptr;
+    const uint32_t* nombre = nullptr;
+    const uint32_t* apellido = nullptr;
+    const uint16_t* anio = nullptr;
+    const CiudadId* ciudad = nullptr;
+    const uint8_t* declarante = nullptr;
+    const char* grupo = nullptr;
+    std::vector<std::string> cadenas;  // Diccionario; debe empezar con las ciudades (ver inicioDiccionario)
+};
+
+// Diccionario inicial: las ciudades en orden de CiudadId
+std::vector<std::string> inicioDiccionario();
+
+/**
+ * Escribe el snapshot en 'ruta'.
+ *
+ * CÓMO: Escritura secuencial en bloques de 1 MiB; la suma de verificación se calcula
+ *       por bloque al escribir y la cabecera se completa al final.
+ * @return false (con el motivo en 'error') si no se pudo escribir.
+ */
+bool guardarSnapshot(const std::string& ruta, const ColumnasSnapshot& columnas, std::string& error);
+
+// Archivo mapeado en memoria (archivo_mapeado.h)
+class ArchivoMapeado;
+
+/**
+ * Snapshot abierto con mmap.
+ *
+ * POR QUÉ: Leer el archivo completo tardaría lo mismo que generarlo de nuevo.
+ * CÓMO: Se mapea de solo lectura; se validan cabecera, límites de las secciones,
+ *       diccionario de ciudades y las columnas que indexan arreglos (ciudad y grupo).
+ *       La suma de todos los datos es opcional porque obliga a leer cada página.
+ * PARA QUÉ: Que vista() entregue un PersonaStore listo para los análisis.
+ */
+class Snapshot {
+public:
+    // Abre y valida 'ruta'; nullptr (con el motivo en 'error') si no es un snapshot válido
+    static std::unique_ptr<Snapshot> abrir(const std::string& ruta, bool verificarDatos, std::string& error);
+
+    size_t filas() const { return static_cast<size_t>(cabecera->filas); }
+    size_t tamArchivo() const { return static_cast<size_t>(cabecera->tamArchivo); }
+    size_t numCadenas() const { return static_cast<size_t>(cabecera->numCadenas); }
+
+    // Columnas sin copiar (válidas mientras viva el Snapshot o un PersonaStore de vista())
+    const uint64_t* id() const { return seccion<uint64_t>(SEC_ID); }
+    const double* ingresos() const { return seccion<double>(SEC_INGRESOS); }
+    const double* patrimonio() const { return seccion<double>(SEC_PATRIMONIO); }
+    const double* deudas() const { return seccion<double>(SEC_DEUDAS); }
+    const uint32_t* fecha() const { return seccion<uint32_t>(SEC_FECHA); }
+    const uint32_t* nombre() const { return seccion<uint32_t>(SEC_NOMBRE); }
+    const uint32_t* apellido() const { return seccion<uint32_t>(SEC_APELLIDO); }
+    const uint16_t* anio() const { return seccion<uint16_t>(SEC_ANIO); }
+    const CiudadId* ciudad() const { return seccion<CiudadId>(SEC_CIUDAD); }
+    const uint8_t* declarante() const { return seccion<uint8_t>(SEC_DECLARANTE); }
+    const char* grupo() const { return seccion<char>(SEC_GRUPO); }
+
+    // Cadena 'indice' del diccionario; vacía si el índice no existe
+    std::string cadena(uint32_t indice) const;
+
+    // PersonaStore cuyas columnas son vistas sobre el archivo (lo mantiene mapeado)
+    PersonaStore vista() const;
+
+    // Devuelve al sistema las páginas de las filas [desde, hasta) de todas las columnas
+    // (procesamiento por lotes: la memoria residente no crece con el tamaño del archivo)
+    void liberarFilas(size_t desde, size_t hasta) const;
+
+private:
+    Snapshot() = default;
+
+    template <typename T>
+    const T* seccion(SeccionSnapshot s) const {
+        return reinterpret_cast<const T*>(base + cabecera->desplazamiento[s]);
+    }
+
+    std::shared_ptr<ArchivoMapeado> archivo;
+    const char* base = nullptr;
+    const CabeceraSnapshot* cabecera = nullptr;
+};
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,41 @@
+#ifndef TEXTO_H
+#define TEXTO_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+/**
+ * Referencia a un texto que vive en otra parte (arena de textos o archivo mapeado).
+ *
+ * POR QUÉ: Un std::string por nombre y apellido es una asignación de memoria por campo y
+ *          un destructor por persona; con millones de personas el asignador domina.
+ * CÓMO: Puntero y longitud, como std::string_view (que no existe en C++14); no es dueño
+ *       de sus bytes, así que quien lo crea debe mantenerlos vivos.
+ * PARA QUÉ: Que Persona sea trivialmente copiable y destruible.
+ */
+struct Texto {
+    const char* datos = nullptr;
+    size_t largo = 0;
+
+    Texto() = default;
+    Texto(const char* datos, size_t largo) : datos(datos), largo(largo) {}
+
+    const char* data() const { return datos; }
+    size_t size() const { return largo; }
+    bool empty() const { return largo == 0; }
+    std::string str() const { return std::string(datos, largo); }
+};
+
+inline bool operator==(const Texto& a, const Texto& b) {
+    return a.largo == b.largo && (a.largo == 0 || std::memcmp(a.datos, b.datos, a.largo) == 0);
+}
+
+inline bool operator!=(const Texto& a, const Texto& b) { return !(a == b); }
+
+inline std::ostream& operator<<(std::ostream& salida, const Texto& texto) {
+    return salida.write(texto.datos, static_cast<std::streamsize>(texto.largo));
+}
+
+#endif // TEXTO_H
@@ -0,0 +1,368 @@
+#include "vectorial.h"
+#include <cstring>  // std::memcpy, std::strcmp
+#include <initializer_list>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VECTORIAL_X86 1
+#include <immintrin.h>
+#endif
+
+// Valores por tramo en posicionMaximo (múltiplo de 8: dos registros AVX2 por paso)
+static const size_t TRAMO_MAXIMO = 256;
+
+// Grupos que cuentan las versiones vectoriales (con más se usa el bucle escalar)
+static const size_t MAX_GRUPOS_CONTEO = 8;
+
+// Iteraciones antes de vaciar los contadores de bytes de SSE2 (un byte llega a 255)
+static const size_t VUELTAS_CONTADOR = 255;
+
+const char* nombreNivelSimd(NivelSimd nivel) {
+    switch (nivel) {
+        case NivelSimd::Escalar: return "escalar";
+        case NivelSimd::SSE2: return "sse2";
+        case NivelSimd::AVX2: return "avx2";
+    }
+    return "";
+}
+
+bool leerNivelSimd(const char* nombre, NivelSimd& nivel) {
+    for (NivelSimd n : {NivelSimd::Escalar, NivelSimd::SSE2, NivelSimd::AVX2}) {
+        if (std::strcmp(nombre, nombreNivelSimd(n)) == 0) {
+            nivel = n;
+            return true;
+        }
+    }
+    return false;
+}
+
+NivelSimd nivelSimdDisponible() {
+#ifdef VECTORIAL_X86
+    // __builtin_cpu_supports también comprueba que el sistema guarde los registros AVX
+    static const NivelSimd nivel = __builtin_cpu_supports("avx2") ? NivelSimd::AVX2
+                                 : __builtin_cpu_supports("sse2") ? NivelSimd::SSE2
+                                 : NivelSimd::Escalar;
+    return nivel;
+#else
+    return NivelSimd::Escalar;
+#endif
+}
+
+static NivelSimd acotar(NivelSimd nivel) {
+    NivelSimd disponible = nivelSimdDisponible();
+    return (nivel < disponible) ? nivel : disponible;
+}
+
+// --- Versiones escalares (los bucles originales) ---
+
+static size_t posicionMaximoEscalar(const double* valores, size_t n) {
+    size_t mejor = 0;
+    for (size_t i = 1; i < n; ++i) {
+        if (valores[i] > valores[mejor]) mejor = i;
+    }
+    return mejor;
+}
+
+// Suma las posiciones [desde, n) en las parciales s[i % 4] (cola de las versiones vectoriales)
+static void sumarConMascaraEn(const double* valores, const uint8_t* marcas, size_t desde, size_t n, double* s) {
+    for (size_t i = desde; i < n; ++i) s[i % 4] += marcas[i] ? valores[i] : 0.0;
+}
+
+static void contarMarcadosEscalar(const char* grupos, char primerCodigo, const uint8_t* marcas,
+                                  size_t desde, size_t n, size_t* total, size_t* marcados) {
+    for (size_t i = desde; i < n; ++i) {
+        int g = grupos[i] - primerCodigo;
+        total[g]++;
+        marcados[g] += (marcas[i] != 0);
+    }
+}
+
+static void contarMenoresEscalar(const char* grupos, char primerCodigo, const uint16_t* valores, uint16_t limite,
+                                 size_t desde, size_t n, size_t* total, size_t* menores) {
+    for (size_t i = desde; i < n; ++i) {
+        int g = grupos[i] - primerCodigo;
+        total[g]++;
+        menores[g] += (valores[i] < limite);
+    }
+}
+
+#ifdef VECTORIAL_X86
+
+#define OBJETIVO_SSE2 __attribute__((target("sse2")))
+#define OBJETIVO_AVX2 __attribute__((target("avx2,popcnt")))
+
+// --- SSE2 (2 doubles o 16 bytes por registro) ---
+
+OBJETIVO_SSE2 static size_t posicionMaximoSSE2(const double* valores, size_t n) {
+    size_t mejor = 0;
+    double maximo = valores[0];
+    size_t i = 0;
+    for (; i + TRAMO_MAXIMO <= n; i += TRAMO_MAXIMO) {
+        __m128d a = _mm_loadu_pd(valores + i);
+        __m128d b = _mm_loadu_pd(valores + i + 2);
+        for (size_t j = i + 4; j < i + TRAMO_MAXIMO; j += 4) {
+            a = _mm_max_pd(a, _mm_loadu_pd(valores + j));
+            b = _mm_max_pd(b, _mm_loadu_pd(valores + j + 2));
+        }
+        a = _mm_max_pd(a, b);
+        double tramo = _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a)));
+        if (tramo > maximo) {
+            maximo = tramo;
+            __m128d buscado = _mm_set1_pd(tramo);
+            for (size_t j = i;; j += 2) {
+                int iguales = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(valores + j), buscado));
+                if (iguales) {
+                    mejor = j + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(iguales)));
+                    break;
+                }
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        if (valores[i] > maximo) {
+            maximo = valores[i];
+            mejor = i;
+        }
+    }
+    return mejor;
+}
+
+OBJETIVO_SSE2 static double sumaConMascaraSSE2(const double* valores, const uint8_t* marcas, size_t n) {
+    __m128d s01 = _mm_setzero_pd();  // Parciales 0 y 1
+    __m128d s23 = _mm_setzero_pd();  // Parciales 2 y 3
+    const __m128i cero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t bytes;
+        std::memcpy(&bytes, marcas + i, sizeof(bytes));
+        __m128i marca = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), cero), cero);
+        __m128i sinMarca = _mm_cmpeq_epi32(marca, cero);  // Una máscara de 32 bits por posición
+        __m128d sin01 = _mm_castsi128_pd(_mm_shuffle_epi32(sinMarca, _MM_SHUFFLE(1, 1, 0, 0)));
+        __m128d sin23 = _mm_castsi128_pd(_mm_shuffle_epi32(sinMarca, _MM_SHUFFLE(3, 3, 2, 2)));
+        s01 = _mm_add_pd(s01, _mm_andnot_pd(sin01, _mm_loadu_pd(valores + i)));
+        s23 = _mm_add_pd(s23, _mm_andnot_pd(sin23, _mm_loadu_pd(valores + i + 2)));
+    }
+    double s[4];
+    _mm_storeu_pd(s, s01);
+    _mm_storeu_pd(s + 2, s23);
+    sumarConMascaraEn(valores, marcas, i, n, s);
+    return (s[0] + s[1]) + (s[2] + s[3]);
+}
+
+// Suma los bytes de un contador SSE2 en 'destino'
+OBJETIVO_SSE2 static void vaciarContador(__m128i contador, size_t& destino) {
+    __m128i suma = _mm_sad_epu8(contador, _mm_setzero_si128());  // Dos sumas de 8 bytes
+    destino += static_cast<size_t>(_mm_cvtsi128_si32(suma)) +
+               static_cast<size_t>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(suma, suma)));
+}
+
+// SSE2 no tiene popcnt: cada grupo lleva un contador por byte (restar la máscara de
+// comparación suma 1) que se vacía cada VUELTAS_CONTADOR iteraciones
+OBJETIVO_SSE2 static void contarMarcadosSSE2(const char* grupos, char primerCodigo, size_t numGrupos,
+                                             const uint8_t* marcas, size_t n, size_t* total, size_t* marcados) {
+    size_t i = 0;
+    while (i + 16 <= n) {
+        __m128i cuentaTotal[MAX_GRUPOS_CONTEO], cuentaMarcados[MAX_GRUPOS_CONTEO];
+        for (size_t k = 0; k < numGrupos; ++k) cuentaTotal[k] = cuentaMarcados[k] = _mm_setzero_si128();
+        size_t fin = (n - i < 16 * VUELTAS_CONTADOR) ? n : i + 16 * VUELTAS_CONTADOR;
+        for (; i + 16 <= fin; i += 16) {
+            __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(grupos + i));
+            __m128i sinMarca = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(marcas + i)),
+                                              _mm_setzero_si128());
+            for (size_t k = 0; k < numGrupos; ++k) {
+                __m128i delGrupo = _mm_cmpeq_epi8(g, _mm_set1_epi8(static_cast<char>(primerCodigo + k)));
+                cuentaTotal[k] = _mm_sub_epi8(cuentaTotal[k], delGrupo);
+                cuentaMarcados[k] = _mm_sub_epi8(cuentaMarcados[k], _mm_andnot_si128(sinMarca, delGrupo));
+            }
+        }
+        for (size_t k = 0; k < numGrupos; ++k) {
+            vaciarContador(cuentaTotal[k], total[k]);
+            vaciarContador(cuentaMarcados[k], marcados[k]);
+        }
+    }
+    contarMarcadosEscalar(grupos, primerCodigo, marcas, i, n, total, marcados);
+}
+
+// valores < limite sin signo: con el bit alto invertido se puede comparar con signo
+OBJETIVO_SSE2 static void contarMenoresSSE2(const char* grupos, char primerCodigo, size_t numGrupos,
+                                            const uint16_t* valores, uint16_t limite, size_t n,
+                                            size_t* total, size_t* menores) {
+    const __m128i signo = _mm_set1_epi16(static_cast<short>(0x8000));
+    const __m128i tope = _mm_set1_epi16(static_cast<short>(limite ^ 0x8000));
+    size_t i = 0;
+    while (i + 16 <= n) {
+        __m128i cuentaTotal[MAX_GRUPOS_CONTEO], cuentaMenores[MAX_GRUPOS_CONTEO];
+        for (size_t k = 0; k < numGrupos; ++k) cuentaTotal[k] = cuentaMenores[k] = _mm_setzero_si128();
+        size_t fin = (n - i < 16 * VUELTAS_CONTADOR) ? n : i + 16 * VUELTAS_CONTADOR;
+        for (; i + 16 <= fin; i += 16) {
+            __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(grupos + i));
+            __m128i v0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(valores + i)), signo);
+            __m128i v1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(valores + i + 8)), signo);
+            __m128i menor = _mm_packs_epi16(_mm_cmpgt_epi16(tope, v0), _mm_cmpgt_epi16(tope, v1));
+            for (size_t k = 0; k < numGrupos; ++k) {
+                __m128i delGrupo = _mm_cmpeq_epi8(g, _mm_set1_epi8(static_cast<char>(primerCodigo + k)));
+                cuentaTotal[k] = _mm_sub_epi8(cuentaTotal[k], delGrupo);
+                cuentaMenores[k] = _mm_sub_epi8(cuentaMenores[k], _mm_and_si128(menor, delGrupo));
+            }
+        }
+        for (size_t k = 0; k < numGrupos; ++k) {
+            vaciarContador(cuentaTotal[k], total[k]);
+            vaciarContador(cuentaMenores[k], menores[k]);
+        }
+    }
+    contarMenoresEscalar(grupos, primerCodigo, valores, limite, i, n, total, menores);
+}
+
+// --- AVX2 (4 doubles o 32 bytes por registro) ---
+
+OBJETIVO_AVX2 static size_t posicionMaximoAVX2(const double* valores, size_t n) {
+    size_t mejor = 0;
+    double maximo = valores[0];
+    size_t i = 0;
+    for (; i + TRAMO_MAXIMO <= n; i += TRAMO_MAXIMO) {
+        __m256d a = _mm256_loadu_pd(valores + i);
+        __m256d b = _mm256_loadu_pd(valores + i + 4);
+        for (size_t j = i + 8; j < i + TRAMO_MAXIMO; j += 8) {
+            a = _mm256_max_pd(a, _mm256_loadu_pd(valores + j));
+            b = _mm256_max_pd(b, _mm256_loadu_pd(valores + j + 4));
+        }
+        a = _mm256_max_pd(a, b);
+        __m128d m = _mm_max_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+        double tramo = _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+        if (tramo > maximo) {
+            maximo = tramo;
+            __m256d buscado = _mm256_set1_pd(tramo);
+            for (size_t j = i;; j += 4) {
+                int iguales = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(valores + j), buscado, _CMP_EQ_OQ));
+                if (iguales) {
+                    mejor = j + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(iguales)));
+                    break;
+                }
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        if (valores[i] > maximo) {
+            maximo = valores[i];
+            mejor = i;
+        }
+    }
+    return mejor;
+}
+
+OBJETIVO_AVX2 static double sumaConMascaraAVX2(const double* valores, const uint8_t* marcas, size_t n) {
+    __m256d suma = _mm256_setzero_pd();  // Parcial i % 4 en el carril i % 4
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int32_t bytes;
+        std::memcpy(&bytes, marcas + i, sizeof(bytes));
+        __m256i marca = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(bytes));
+        __m256d sinMarca = _mm256_castsi256_pd(_mm256_cmpeq_epi64(marca, _mm256_setzero_si256()));
+        suma = _mm256_add_pd(suma, _mm256_andnot_pd(sinMarca, _mm256_loadu_pd(valores + i)));
+    }
+    double s[4];
+    _mm256_storeu_pd(s, suma);
+    sumarConMascaraEn(valores, marcas, i, n, s);
+    return (s[0] + s[1]) + (s[2] + s[3]);
+}
+
+OBJETIVO_AVX2 static void contarMarcadosAVX2(const char* grupos, char primerCodigo, size_t numGrupos,
+                                             const uint8_t* marcas, size_t n, size_t* total, size_t* marcados) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i g = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(grupos + i));
+        __m256i sinMarca = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(marcas + i)),
+                                             _mm256_setzero_si256());
+        for (size_t k = 0; k < numGrupos; ++k) {
+            __m256i delGrupo = _mm256_cmpeq_epi8(g, _mm256_set1_epi8(static_cast<char>(primerCodigo + k)));
+            total[k] += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(delGrupo)));
+            marcados[k] += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_andnot_si256(sinMarca, delGrupo))));
+        }
+    }
+    contarMarcadosEscalar(grupos, primerCodigo, marcas, i, n, total, marcados);
+}
+
+OBJETIVO_AVX2 static void contarMenoresAVX2(const char* grupos, char primerCodigo, size_t numGrupos,
+                                            const uint16_t* valores, uint16_t limite, size_t n,
+                                            size_t* total, size_t* menores) {
+    const __m256i signo = _mm256_set1_epi16(static_cast<short>(0x8000));
+    const __m256i tope = _mm256_set1_epi16(static_cast<short>(limite ^ 0x8000));
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i g = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(grupos + i));
+        __m256i v0 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(valores + i)), signo);
+        __m256i v1 = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(valores + i + 16)), signo);
+        // packs trabaja por mitades de 128 bits: permute4x64 devuelve los bytes al orden de las filas
+        __m256i menor = _mm256_permute4x64_epi64(
+            _mm256_packs_epi16(_mm256_cmpgt_epi16(tope, v0), _mm256_cmpgt_epi16(tope, v1)), 0xD8);
+        for (size_t k = 0; k < numGrupos; ++k) {
+            __m256i delGrupo = _mm256_cmpeq_epi8(g, _mm256_set1_epi8(static_cast<char>(primerCodigo + k)));
+            total[k] += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(delGrupo)));
+            menores[k] += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(menor, delGrupo))));
+        }
+    }
+    contarMenoresEscalar(grupos, primerCodigo, valores, limite, i, n, total, menores);
+}
+
+#endif // VECTORIAL_X86
+
+// --- Despacho ---
+
+size_t posicionMaximo(const double* valores, size_t n, NivelSimd nivel) {
+    if (n == 0) return 0;
+    switch (acotar(nivel)) {
+#ifdef VECTORIAL_X86
+        case NivelSimd::AVX2: return posicionMaximoAVX2(valores, n);
+        case NivelSimd::SSE2: return posicionMaximoSSE2(valores, n);
+#endif
+        default: return posicionMaximoEscalar(valores, n);
+    }
+}
+
+double sumaConMascara(const double* valores, const uint8_t* marcas, size_t n, NivelSimd nivel) {
+    switch (acotar(nivel)) {
+#ifdef VECTORIAL_X86
+        case NivelSimd::AVX2: return sumaConMascaraAVX2(valores, marcas, n);
+        case NivelSimd::SSE2: return sumaConMascaraSSE2(valores, marcas, n);
+#endif
+        default: {
+            double s[4] = {0, 0, 0, 0};
+            sumarConMascaraEn(valores, marcas, 0, n, s);
+            return (s[0] + s[1]) + (s[2] + s[3]);
+        }
+    }
+}
+
+void contarMarcadosPorGrupo(const char* grupos, char primerCodigo, size_t numGrupos, const uint8_t* marcas,
+                            size_t n, size_t* total, size_t* marcados, NivelSimd nivel) {
+    if (numGrupos > MAX_GRUPOS_CONTEO) nivel = NivelSimd::Escalar;
+    switch (acotar(nivel)) {
+#ifdef VECTORIAL_X86
+        case NivelSimd::AVX2: contarMarcadosAVX2(grupos, primerCodigo, numGrupos, marcas, n, total, marcados); break;
+        case NivelSimd::SSE2: contarMarcadosSSE2(grupos, primerCodigo, numGrupos, marcas, n, total, marcados); break;
+#endif
+        default: contarMarcadosEscalar(grupos, primerCodigo, marcas, 0, n, total, marcados); break;
+    }
+}
+
+void contarMenoresPorGrupo(const char* grupos, char primerCodigo, size_t numGrupos, const uint16_t* valores,
+                           uint16_t limite, size_t n, size_t* total, size_t* menores, NivelSimd nivel) {
+    if (numGrupos > MAX_GRUPOS_CONTEO) nivel = NivelSimd::Escalar;
+    switch (acotar(nivel)) {
+#ifdef VECTORIAL_X86
+        case NivelSimd::AVX2:
+            contarMenoresAVX2(grupos, primerCodigo, numGrupos, valores, limite, n, total, menores);
+            break;
+        case NivelSimd::SSE2:
+            contarMenoresSSE2(grupos, primerCodigo, numGrupos, valores, limite, n, total, menores);
+            break;
+#endif
+        default: contarMenoresEscalar(grupos, primerCodigo, valores, limite, 0, n, total, menores); break;
+    }
+}
+
+void acumularPorGrupo(const uint8_t* grupos, const double* valores, size_t n, double* sumas, size_t* conteos) {
+    for (size_t i = 0; i < n; ++i) {
+        sumas[grupos[i]] += valores[i];
+        conteos[grupos[i]]++;
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef VECTORIAL_H
+#define VECTORIAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+// --- Núcleos vectoriales (SSE2/AVX2) para los recorridos numéricos sobre columnas ---
+
+/**
+ * Juego de instrucciones de un núcleo.
+ *
+ * POR QUÉ: El programa se compila para x86-64 genérico (SSE2), pero casi todos los
+ *          procesadores actuales tienen AVX2; compilar con -mavx2 rompería en los demás.
+ * CÓMO: Cada núcleo tiene una versión escalar (el bucle original), una SSE2 y una AVX2
+ *       compiladas con __attribute__((target)); se elige en tiempo de ejecución con
+ *       __builtin_cpu_supports. Fuera de x86 solo existe la escalar.
+ * PARA QUÉ: Usar el mejor juego disponible sin cambiar las banderas de compilación, y
+ *           poder comparar los tres en el microbenchmark.
+ */
+enum class NivelSimd { Escalar, SSE2, AVX2 };
+
+const char* nombreNivelSimd(NivelSimd nivel);
+
+// Mejor nivel que soporta el procesador (se consulta una vez)
+NivelSimd nivelSimdDisponible();
+
+// Nivel máximo que pueden usar los análisis; se cambia con --simd para comparar
+inline NivelSimd& limiteNivelSimd() {
+    static NivelSimd limite = NivelSimd::AVX2;
+    return limite;
+}
+
+// Nivel que usan los análisis: el disponible, acotado por limiteNivelSimd()
+inline NivelSimd nivelSimdActivo() {
+    NivelSimd disponible = nivelSimdDisponible();
+    return (limiteNivelSimd() < disponible) ? limiteNivelSimd() : disponible;
+}
+
+// Lee "escalar", "sse2" o "avx2"; false si el nombre no es válido
+bool leerNivelSimd(const char* nombre, NivelSimd& nivel);
+
+// Todos los núcleos aceptan un nivel mayor que el disponible y lo acotan.
+
+/**
+ * Posición del primer máximo de valores[0, n) (n si n == 0).
+ *
+ * CÓMO: Vectorial por tramos de 256 valores: máximo del tramo con max_pd y, solo si
+ *       supera al mejor hasta ahora, búsqueda de su primera aparición en el tramo.
+ *       Como el mejor solo cambia si es estrictamente mayor, en empate gana la primera
+ *       posición, igual que el bucle escalar.
+ */
+size_t posicionMaximo(const double* valores, size_t n, NivelSimd nivel = nivelSimdActivo());
+
+/**
+ * Suma de los valores cuya marca es distinta de 0.
+ *
+ * CÓMO: Cuatro sumas parciales (la posición i suma en la parcial i % 4) que se combinan
+ *       como (s0 + s1) + (s2 + s3). Todos los niveles, incluido el escalar, usan ese
+ *       orden, así que el resultado es el mismo en cualquier procesador; difiere en los
+ *       últimos bits del de una suma secuencial.
+ */
+double sumaConMascara(const double* valores, const uint8_t* marcas, size_t n, NivelSimd nivel = nivelSimdActivo());
+
+/**
+ * Cuenta por grupo las filas y las que tienen marca distinta de 0, y lo suma en
+ * total[g] y marcados[g] (grupo g = código primerCodigo + g).
+ *
+ * CÓMO: Una comparación de bytes por grupo cada 32 filas (AVX2: popcount de la máscara)
+ *       o 16 (SSE2: contadores de un byte que se vacían antes de desbordarse). Pensado
+ *       para pocos grupos (calendario DIAN): con más de 8 se usa el bucle escalar.
+ *       Todos los códigos de 'grupos' deben estar en [primerCodigo, primerCodigo + numGrupos).
+ */
+void contarMarcadosPorGrupo(const char* grupos, char primerCodigo, size_t numGrupos, const uint8_t* marcas,
+                            size_t n, size_t* total, size_t* marcados, NivelSimd nivel = nivelSimdActivo());
+
+// Como contarMarcadosPorGrupo, con la marca valores[i] < limite (enteros sin signo de 16 bits)
+void contarMenoresPorGrupo(const char* grupos, char primerCodigo, size_t numGrupos, const uint16_t* valores,
+                           uint16_t limite, size_t n, size_t* total, size_t* menores,
+                           NivelSimd nivel = nivelSimdActivo());
+
+/**
+ * Suma valores[i] en sumas[grupos[i]] y cuenta la fila en conteos[grupos[i]].
+ *
+ * POR QUÉ no tiene versión vectorial: AVX2 no tiene scatter, y repartir las sumas en
+ *       carriles cambiaría el orden de suma (y el resultado frente al modo objetos). Con
+ *       las 20 ciudades, separar el conteo (comparaciones de bytes o tablas alternadas)
+ *       de las sumas resultó más lento que este bucle en el microbenchmark (opción 31),
+ *       que ya va a unos 4 GB/s por hilo: con todos los hilos el límite es la memoria.
+ */
+void acumularPorGrupo(const uint8_t* grupos, const double* valores, size_t n, double* sumas, size_t* conteos);
+
+#endif // VECTORIAL_H
@@ -4,33 +4,45 @@
 #include <string>
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
+#include "ciudades.h"
+#include "fecha.h"
+#include "buffer_salida.h"
+#include "texto.h"
 
 // Estructura que representa una persona con datos personales y fiscales
 struct Persona {
     // Datos básicos de identificación
-    std::string nombre;           // Nombre de pila
-    std::string apellido;         // Apellidos
-    std::string id;               // Identificador único
-    std::string ciudadNacimiento; // Ciudad de nacimiento en Colombia
-    std::string fechaNacimiento;  // Fecha en formato DD/MM/AAAA
+    Texto nombre;                 // Nombre de pila (en una ArenaTextos, ver arena_textos.h)
+    Texto apellido;               // Apellidos (en una ArenaTextos)
+    uint64_t id;                  // Identificador único (numérico)
     
     // Datos fiscales y económicos
     double ingresosAnuales;       // Ingresos anuales en pesos colombianos
     double patrimonio;            // Valor total de bienes y activos
     double deudas;                // Deudas pendientes
     bool declaranteRenta;         // Si está obligado a declarar renta
+    CiudadId ciudadNacimiento;    // Ciudad de nacimiento (índice en el diccionario de ciudades)
+    uint32_t fechaNacimiento;     // Fecha empaquetada como AAAAMMDD
+    uint16_t anioNacimiento;      // Año de nacimiento (precalculado)
+    uint8_t edad;                 // Edad aproximada en ANIO_ACTUAL (precalculada)
+    char grupoDIAN;               // Grupo del calendario DIAN 'A'/'B'/'C' (precalculado)
 
     // --- Métodos de visualización ---
     void mostrar() const;         // Muestra todos los detalles completos
     void mostrarResumen() const;  // Muestra versión compacta para listados
+    void escribirResumen(BufferSalida& salida) const; // Mismo resumen, en un buffer (sin iostream)
 };
 
+// Sin memoria dinámica propia: liberar un vector de personas no recorre sus elementos
+static_assert(std::is_trivially_destructible<Persona>::value, "Persona debe ser trivialmente destruible");
+
 // Implementación de métodos inline para mantener la estructura simple
 inline void Persona::mostrar() const {
     std::cout << "-------------------------------------\n";
     std::cout << "[" << id << "] Nombre: " << nombre << " " << apellido << "\n";
-    std::cout << "   - Ciudad de nacimiento: " << ciudadNacimiento << "\n";
-    std::cout << "   - Fecha de nacimiento: " << fechaNacimiento << "\n\n";
+    std::cout << "   - Ciudad de nacimiento: " << nombreCiudad(ciudadNacimiento) << "\n";
+    std::cout << "   - Fecha de nacimiento: " << formatearFecha(fechaNacimiento) << "\n\n";
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "   - Ingresos anuales: $" << ingresosAnuales << "\n";
     std::cout << "   - Patrimonio: $" << patrimonio << "\n";
@@ -40,8 +52,31 @@ inline void Persona::mostrar() const {
 
 inline void Persona::mostrarResumen() const {
     std::cout << "[" << id << "] " << nombre << " " << apellido
-              << " | " << ciudadNacimiento 
+              << " | " << nombreCiudad(ciudadNacimiento) 
               << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales;
 }
 
+// Misma línea que mostrarResumen; ID e ingresos se formatean a mano
+inline void Persona::escribirResumen(BufferSalida& salida) const {
+    salida.agregar('[');
+    salida.agregarEntero(id);
+    salida.agregar("] ", 2);
+    salida.agregar(nombre);
+    salida.agregar(' ');
+    salida.agregar(apellido);
+    salida.agregar(" | ", 3);
+    salida.agregar(nombreCiudad(ciudadNacimiento));
+    salida.agregar(" | $", 4);
+    salida.agregarDecimal2(ingresosAnuales);
+}
+
+// Política de analitica.h con la que se leen las personas de esta variante (por sus campos públicos)
+template <typename Registro>
+struct AccesoCampos;
+using AccesoPersona = AccesoCampos<Persona>;
+
+// Cómo reciben la colección las opciones 6-8 con objetos (ParametroPersonas, generador.h)
+struct PasoReferencia;
+using PasoPersona = PasoReferencia;
+
 #endif // PERSONA_H
\ No newline at end of file
@@ -5,21 +5,39 @@
  * Implementación del constructor de Persona.
  * 
  * POR QUÉ: Inicializar los miembros de la clase.
- * CÓMO: Usando la lista de inicialización y moviendo los strings para evitar copias.
+ * CÓMO: Usando la lista de inicialización (los textos son referencias a una arena);
+ *       la ciudad llega ya codificada como CiudadId y la fecha empaquetada (AAAAMMDD),
+ *       de la que se precalculan año y edad. El ID es numérico y su grupo DIAN
+ *       llega calculado desde la generación.
  * PARA QUÉ: Eficiencia y correcta construcción del objeto.
  */
-Persona::Persona(std::string nom, std::string ape, std::string id, 
-                 std::string ciudad, std::string fecha, double ingresos, 
+Persona::Persona(Texto nom, Texto ape, uint64_t id, char grupo,
+                 CiudadId ciudad, uint32_t fecha, double ingresos, 
                  double patri, double deud, bool declara)
-    : nombre(std::move(nom)), 
-      apellido(std::move(ape)), 
-      id(std::move(id)), 
-      ciudadNacimiento(std::move(ciudad)),
-      fechaNacimiento(std::move(fecha)), 
+    : nombre(nom), 
+      apellido(ape), 
+      id(id), 
       ingresosAnuales(ingresos), 
       patrimonio(patri),
       deudas(deud), 
-      declaranteRenta(declara) {}
+      declaranteRenta(declara),
+      ciudadNacimiento(ciudad),
+      fechaNacimiento(fecha),
+      anioNacimiento(static_cast<uint16_t>(anioDeFecha(fecha))),
+      edad(static_cast<uint8_t>(calcularEdad(anioDeFecha(fecha)))),
+      grupoDIAN(grupo) {}
+
+Persona::Persona()
+    : id(0), 
+      ingresosAnuales(0), 
+      patrimonio(0),
+      deudas(0), 
+      declaranteRenta(false),
+      ciudadNacimiento(0),
+      fechaNacimiento(0),
+      anioNacimiento(0),
+      edad(0),
+      grupoDIAN('A') {}
 
 /**
  * Implementación de mostrar.
@@ -31,8 +49,8 @@ Persona::Persona(std::string nom, std::string ape, std::string id,
 void Persona::mostrar() const {
     std::cout << "-------------------------------------\n";
     std::cout << "[" << id << "] Nombre: " << nombre << " " << apellido << "\n";
-    std::cout << "   - Ciudad de nacimiento: " << ciudadNacimiento << "\n";
-    std::cout << "   - Fecha de nacimiento: " << fechaNacimiento << "\n\n";
+    std::cout << "   - Ciudad de nacimiento: " << nombreCiudad(ciudadNacimiento) << "\n";
+    std::cout << "   - Fecha de nacimiento: " << formatearFecha(fechaNacimiento) << "\n\n";
     std::cout << std::fixed << std::setprecision(2); // Formato de números
     std::cout << "   - Ingresos anuales: $" << ingresosAnuales << "\n";
     std::cout << "   - Patrimonio: $" << patrimonio << "\n";
@@ -49,6 +67,26 @@ void Persona::mostrar() const {
  */
 void Persona::mostrarResumen() const {
     std::cout << "[" << id << "] " << nombre << " " << apellido
-              << " | " << ciudadNacimiento 
+              << " | " << nombreCiudad(ciudadNacimiento) 
               << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales;
-}
\ No newline at end of file
+}
+
+/**
+ * Implementación de escribirResumen.
+ * 
+ * POR QUÉ: Producir exactamente la línea de mostrarResumen sin pasar por std::cout.
+ * CÓMO: Agrega cada campo al buffer; el ID y los ingresos se formatean a mano.
+ * PARA QUÉ: Volcado masivo en pocas llamadas a write(2).
+ */
+void Persona::escribirResumen(BufferSalida& salida) const {
+    salida.agregar('[');
+    salida.agregarEntero(id);
+    salida.agregar("] ", 2);
+    salida.agregar(nombre);
+    salida.agregar(' ');
+    salida.agregar(apellido);
+    salida.agregar(" | ", 3);
+    salida.agregar(nombreCiudad(ciudadNacimiento));
+    salida.agregar(" | $", 4);
+    salida.agregarDecimal2(ingresosAnuales);
+}
@@ -4,6 +4,11 @@
 #include <string>
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
+#include "ciudades.h"
+#include "fecha.h"
+#include "buffer_salida.h"
+#include "texto.h"
 
 /**
  * Clase que representa una persona con datos personales y financieros.
@@ -14,34 +19,52 @@
  */
 class Persona {
 private:
-    std::string nombre;           // Nombre de pila
-    std::string apellido;         // Apellidos
-    std::string id;               // Identificador único (cédula)
-    std::string ciudadNacimiento; // Ciudad de nacimiento
-    std::string fechaNacimiento;  // Fecha de nacimiento en formato DD/MM/AAAA
+    Texto nombre;                 // Nombre de pila (en una ArenaTextos, ver arena_textos.h)
+    Texto apellido;               // Apellidos (en una ArenaTextos)
+    uint64_t id;                  // Identificador único (cédula, numérica)
     double ingresosAnuales;       // Ingresos anuales en pesos colombianos
     double patrimonio;            // Patrimonio total (activos)
     double deudas;                // Deudas totales (pasivos)
     bool declaranteRenta;         // Si es declarante de renta
+    CiudadId ciudadNacimiento;    // Ciudad de nacimiento (índice en el diccionario de ciudades)
+    uint32_t fechaNacimiento;     // Fecha de nacimiento empaquetada como AAAAMMDD
+    uint16_t anioNacimiento;      // Año de nacimiento (precalculado)
+    uint8_t edad;                 // Edad aproximada en ANIO_ACTUAL (precalculada)
+    char grupoDIAN;               // Grupo del calendario DIAN 'A'/'B'/'C' (precalculado)
 
 public:
     /**
      * Constructor para inicializar todos los atributos de la persona.
      * 
      * POR QUÉ: Necesidad de crear instancias de Persona con todos sus datos.
-     * CÓMO: Recibe cada atributo por valor y los mueve a los miembros correspondientes.
+     * CÓMO: Recibe cada atributo por valor; los textos ya deben estar en una arena
+     *       que viva al menos tanto como la persona.
      * PARA QUÉ: Construir objetos Persona completos y válidos.
      */
-    Persona(std::string nom, std::string ape, std::string id, 
-            std::string ciudad, std::string fecha, double ingresos, 
+    Persona(Texto nom, Texto ape, uint64_t id, char grupo,
+            CiudadId ciudad, uint32_t fecha, double ingresos, 
             double patri, double deud, bool declara);
     
+    /**
+     * Constructor por defecto (persona vacía, con valores en cero).
+     * 
+     * POR QUÉ: generarColeccion crea el vector con su tamaño final antes de llenarlo.
+     * CÓMO: Inicializando los campos numéricos en cero y los textos vacíos.
+     * PARA QUÉ: Que cada hilo asigne directamente su rango de posiciones.
+     */
+    Persona();
+    
     // Métodos de acceso (getters) - Implementados inline para eficiencia
-    std::string getNombre() const { return nombre; }
-    std::string getApellido() const { return apellido; }
-    std::string getId() const { return id; }
-    std::string getCiudadNacimiento() const { return ciudadNacimiento; }
-    std::string getFechaNacimiento() const { return fechaNacimiento; }
+    // Los textos se devuelven como Texto (puntero y longitud): leerlos no copia ni asigna memoria
+    Texto getNombre() const { return nombre; }
+    Texto getApellido() const { return apellido; }
+    uint64_t getId() const { return id; }
+    char getGrupoDIAN() const { return grupoDIAN; }
+    CiudadId getCiudadId() const { return ciudadNacimiento; }
+    const std::string& getCiudadNacimiento() const { return nombreCiudad(ciudadNacimiento); }
+    uint32_t getFechaNacimiento() const { return fechaNacimiento; }
+    int getAnioNacimiento() const { return anioNacimiento; }
+    int getEdad() const { return edad; }
     double getIngresosAnuales() const { return ingresosAnuales; }
     double getPatrimonio() const { return patrimonio; }
     double getDeudas() const { return deudas; }
@@ -64,6 +87,28 @@ public:
      * PARA QUÉ: Visualización eficiente en colecciones grandes.
      */
     void mostrarResumen() const;
+
+    /**
+     * Escribe el mismo resumen que mostrarResumen en un buffer de salida.
+     * 
+     * POR QUÉ: Con millones de filas, iostream domina el tiempo del listado.
+     * CÓMO: Copia los textos y formatea ID e ingresos con BufferSalida (sin iostream).
+     * PARA QUÉ: Listados completos rápidos a terminal, archivo o pipe.
+     */
+    void escribirResumen(BufferSalida& salida) const;
 };
 
+// Sin memoria dinámica propia: copiar o liberar un vector de personas no recorre sus elementos
+static_assert(std::is_trivially_destructible<Persona>::value, "Persona debe ser trivialmente destruible");
+
+// Política de analitica.h con la que se leen las personas de esta variante (por sus métodos de acceso)
+template <typename Registro>
+struct AccesoMetodos;
+using AccesoPersona = AccesoMetodos<Persona>;
+
+// Cómo reciben la colección las opciones 6-8 con objetos (ParametroPersonas, generador.h)
+// ANÁLISIS RENDIMIENTO: Pass-by-value para medir overhead de copia + method calls
+struct PasoValor;
+using PasoPersona = PasoValor;
+
 #endif // PERSONA_H
\ No newline at end of file